@@ -12,14 +12,36 @@
  *
  *   Для чистоты измерений все случайные данные (числа и сдвиги)
  *   генерируются заранее и помещаются в массив. Основной цикл,
- *   который профилируется, выполняет только копирование структуры
- *   и вызов целевой функции, исключая медленный вызов rand().
+ *   который профилируется, выполняет только копирование делимого
+ *   и вызов целевой функции на месте (q == n), исключая медленный
+ *   вызов rand().
+ *
+ *   После профилируемого цикла печатается таблица нс/вызов по классам
+ *   делителя (d < 2^32, d >= 2^32, d = 2^k) для маршрутизации по умолчанию
+ *   и каждого ядра, с ускорением относительно hwdiv.
+ *
+ *   Затем на делимых, кратных делителю, bignum_divexact_u64 сравнивается
+ *   с bignum_div_u64 (маршрутизация по умолчанию) по тем же классам.
+ *
+ *   Последняя таблица — остатки длинного массива слов по TREE_MODULI
+ *   модулям: bignum_mod_u64_tree против одного прохода
+ *   bignum_mod_u64_multi_limbs для нескольких длин n и ширин модулей.
  *
  * @history
  *   - rev 1.0 (12.08.2025): Первоначальная версия.
  *   - rev 1.1 (13.08.2025): Реализована предварительная генерация данных.
  *   - rev 1.2 (13.08.2025): Добавлены локальные определения констант
  *                           BIGNUM_CAPACITY и BIGNUM_BITS для компиляции.
+ *   - rev 1.3 (15.10.2026): Деление на месте вместо копирования частного.
+ *   - rev 1.4 (15.10.2026): Локальные BIGNUM_CAPACITY и BIGNUM_BITS удалены,
+ *                           используются определения из bignum.h.
+ *   - rev 1.5 (15.10.2026): Фаза 3 — время вызова по классам делителя
+ *                           (d < 2^32 и d >= 2^32) для каждого ядра.
+ *   - rev 1.6 (15.10.2026): Класс делителей d = 2^k.
+ *   - rev 1.7 (16.10.2026): Фаза 4 — bignum_divexact_u64 против
+ *                           bignum_div_u64 на кратных делимых.
+ *   - rev 1.8 (16.10.2026): Фаза 5 — bignum_mod_u64_tree против
+ *                           bignum_mod_u64_multi_limbs.
  *
  * # Сборка
  *  gcc -g -O2 -I include -no-pie -fno-omit-frame-pointer \
@@ -36,15 +58,11 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdbool.h>
 #include <time.h>
 #include <bignum.h>
 #include "bignum_div_u64.h"
 
-// --- Локальные определения для компиляции ---
-// Эти константы должны быть синхронизированы с ассемблерным кодом.
-#define BIGNUM_CAPACITY 32
-#define BIGNUM_BITS (BIGNUM_CAPACITY * 64)
-
 // Увеличиваем количество итераций для более надежных измерений
 #define ITERATIONS (100000000u * 20)
 
@@ -54,6 +72,21 @@
 // Максимальный сдвиг
 #define MAX_SHIFT (BIGNUM_BITS - 1)
 
+// Число вызовов на одну ячейку таблицы классов делителя
+#define CLASS_ITERATIONS 2000000u
+
+// Варианты таблицы: маршрутизация по умолчанию и каждое ядро
+#define CLASS_VARIANTS (1 + BIGNUM_DIV_U64_KERNEL_COUNT)
+
+// Классы делителя: d < 2^32, d >= 2^32, d = 2^k
+#define DIVISOR_CLASSES 3
+
+// Фаза 5: число модулей, длины n и ширины модулей в битах
+#define TREE_MODULI 1024
+#define TREE_LENS 4
+#define TREE_WIDTHS 4
+#define TREE_REPEATS 5
+
 /** Заполняет bignum случайными словами и устанавливает len. */
 static void init_random_bignum(bignum_t *num) {
     int used = (rand() % BIGNUM_CAPACITY) + 1;
@@ -66,23 +99,87 @@ static void init_random_bignum(bignum_t *num) {
     }
 }
 
+/** Возвращает нс/вызов bignum_div_u64 на наборе делимых и делителей. */
+static double time_class(const bignum_t *n_sources, const uint64_t *d) {
+    uint64_t sink = 0;
+    clock_t start = clock();
+    for (uint32_t i = 0; i < CLASS_ITERATIONS; ++i) {
+        unsigned data_idx = i % PREGEN_DATA_COUNT;
+        bignum_t n_dst = n_sources[data_idx];
+        uint64_t rem;
+        bignum_div_u64(&n_dst, &n_dst, d[data_idx], &rem);
+        sink += rem;
+    }
+    clock_t stop = clock();
+    if (sink == 0xDEADBEEF) printf("Sink marker hit.\n");
+    return (double)(stop - start) * 1e9 / CLOCKS_PER_SEC / CLASS_ITERATIONS;
+}
+
+/** Делает n кратным d: n -= n mod d. */
+static void make_multiple(bignum_t *n, uint64_t d) {
+    bignum_t q;
+    uint64_t rem;
+    bignum_div_u64(&q, n, d, &rem);
+    for (int i = 0; i < n->len && rem != 0; ++i) {
+        uint64_t w = n->words[i];
+        n->words[i] = w - rem;
+        rem = w < rem;
+    }
+    while (n->len > 0 && n->words[n->len - 1] == 0) --n->len;
+}
+
+/** Возвращает нс/вызов bignum_divexact_u64 (exact) или bignum_div_u64 на кратных делимых. */
+static double time_exact(const bignum_t *n_sources, const uint64_t *d, bool exact) {
+    uint64_t sink = 0;
+    clock_t start = clock();
+    for (uint32_t i = 0; i < CLASS_ITERATIONS; ++i) {
+        unsigned data_idx = i % PREGEN_DATA_COUNT;
+        bignum_t n_dst = n_sources[data_idx];
+        uint64_t rem = 0;
+        if (exact) {
+            bignum_divexact_u64(&n_dst, &n_dst, d[data_idx]);
+        } else {
+            bignum_div_u64(&n_dst, &n_dst, d[data_idx], &rem);
+        }
+        sink += rem + n_dst.words[0];
+    }
+    clock_t stop = clock();
+    if (sink == 0xDEADBEEF) printf("Sink marker hit.\n");
+    return (double)(stop - start) * 1e9 / CLOCKS_PER_SEC / CLASS_ITERATIONS;
+}
+
+/** Возвращает лучшее из TREE_REPEATS время вызова в мкс: дерево (tree) или один проход. */
+static double time_moduli(const uint64_t *n, size_t len, const uint64_t *d, uint64_t *rem,
+                          uint64_t *scratch, bool tree) {
+    double best = 0;
+    for (int r = 0; r < TREE_REPEATS; ++r) {
+        clock_t start = clock();
+        if (tree) {
+            bignum_mod_u64_tree(n, len, d, TREE_MODULI, rem, scratch);
+        } else {
+            bignum_mod_u64_multi_limbs(n, len, d, TREE_MODULI, rem);
+        }
+        double us = (double)(clock() - start) * 1e6 / CLOCKS_PER_SEC;
+        if (r == 0 || us < best) best = us;
+    }
+    return best;
+}
+
 int main(void) {
     // --- Фаза 1: Предварительная генерация данных ---
     printf("Pregenerating %u data sets...\n", PREGEN_DATA_COUNT);
 
-    bignum_t* q_sources = malloc(sizeof(bignum_t) * PREGEN_DATA_COUNT);
     bignum_t* n_sources = malloc(sizeof(bignum_t) * PREGEN_DATA_COUNT);
     uint64_t* d_u64 = malloc(sizeof(uint64_t) * PREGEN_DATA_COUNT);
     uint64_t* rem_u64 = malloc(sizeof(uint64_t) * PREGEN_DATA_COUNT);
 
-    if (!q_sources || !n_sources || !rem_u64 ||!d_u64) {
+    if (!n_sources || !rem_u64 ||!d_u64) {
         perror("Failed to allocate memory for test data");
         return 1;
     }
 
     srand((unsigned)time(NULL));
     for (unsigned i = 0; i < PREGEN_DATA_COUNT; ++i) {
-        //init_random_bignum(&q_sources[i]);
         init_random_bignum(&n_sources[i]);
         d_u64[i] = (uint64_t)(rand() % MAX_SHIFT);
         //rem_u64[i] = (uint64_t)(rand() % MAX_SHIFT);
@@ -95,14 +192,13 @@ int main(void) {
         // Используем предварительно сгенерированные данные, циклически обращаясь к ним
         unsigned data_idx = i % PREGEN_DATA_COUNT;
         
-        // Копируем исходное число, чтобы не портить эталон
-        bignum_t q_dst = q_sources[data_idx];
+        // Копируем исходное число, чтобы не портить эталон; частное пишется на его место
         bignum_t n_dst = n_sources[data_idx];
         uint64_t d_u64_dst = d_u64[data_idx];
         uint64_t rem_u64_dst = rem_u64[data_idx];
         
         // Вызываем целевую функцию (bignum_t *q, const bignum_t *n, const uint64_t d, uint64_t *rem);
-        bignum_div_u64(&q_dst, &n_dst,  d_u64_dst, &rem_u64_dst);
+        bignum_div_u64(&n_dst, &n_dst,  d_u64_dst, &rem_u64_dst);
         
         // Эта проверка не дает компилятору выбросить вызов функции
         if (n_dst.len == 0xDEADBEEF) {
@@ -114,11 +210,123 @@ int main(void) {
 
     printf("Benchmark finished.\n");
 
-    // --- Фаза 3: Очистка ---
-    free(q_sources);
+    // --- Фаза 3: Время по классам делителя ---
+    uint64_t* d_small = malloc(sizeof(uint64_t) * PREGEN_DATA_COUNT);
+    uint64_t* d_large = malloc(sizeof(uint64_t) * PREGEN_DATA_COUNT);
+    uint64_t* d_pow2 = malloc(sizeof(uint64_t) * PREGEN_DATA_COUNT);
+    if (!d_small || !d_large || !d_pow2) {
+        perror("Failed to allocate memory for divisor classes");
+        return 1;
+    }
+    for (unsigned i = 0; i < PREGEN_DATA_COUNT; ++i) {
+        d_small[i] = ((uint64_t)rand() << 1) | (uint64_t)(rand() & 1);
+        if (d_small[i] < 2) d_small[i] = 3;
+        d_large[i] = ((uint64_t)rand() << 33) | ((uint64_t)rand() << 2) | 0x100000000ull;
+        d_pow2[i] = 1ull << (rand() % 64);
+    }
+    const uint64_t *classes[DIVISOR_CLASSES] = {d_small, d_large, d_pow2};
+
+    double ns[CLASS_VARIANTS][DIVISOR_CLASSES];
+    bool supported[CLASS_VARIANTS];
+    // Маршрутизация по умолчанию замеряется до первой bignum_div_u64_set_kernel
+    supported[0] = true;
+    for (int c = 0; c < DIVISOR_CLASSES; ++c) ns[0][c] = time_class(n_sources, classes[c]);
+    bignum_div_u64_kernel_t saved = bignum_div_u64_get_kernel();
+    for (int k = 0; k < BIGNUM_DIV_U64_KERNEL_COUNT; ++k) {
+        supported[1 + k] = bignum_div_u64_set_kernel((bignum_div_u64_kernel_t)k) == BIGNUM_DIV_U64_OK;
+        if (!supported[1 + k]) continue;
+        for (int c = 0; c < DIVISOR_CLASSES; ++c) ns[1 + k][c] = time_class(n_sources, classes[c]);
+    }
+    bignum_div_u64_set_kernel(saved);
+
+    const double *hw = ns[1 + BIGNUM_DIV_U64_KERNEL_HWDIV];
+    printf("\nDivisor classes, len 1..%d (ns/call, speedup vs hwdiv):\n", BIGNUM_CAPACITY);
+    printf("  %-10s %18s %18s %18s\n", "kernel", "d < 2^32", "d >= 2^32", "d = 2^k");
+    for (int v = 0; v < CLASS_VARIANTS; ++v) {
+        const char *name = v == 0 ? "default" : bignum_div_u64_kernel_name((bignum_div_u64_kernel_t)(v - 1));
+        if (!supported[v]) {
+            printf("  %-10s %18s %18s %18s\n", name, "unsupported", "unsupported", "unsupported");
+            continue;
+        }
+        printf("  %-10s", name);
+        for (int c = 0; c < DIVISOR_CLASSES; ++c) printf(" %9.1f (%5.2fx)", ns[v][c], hw[c] / ns[v][c]);
+        printf("\n");
+    }
+
+    // --- Фаза 4: Точное деление на кратных делимых ---
+    bignum_t* n_multiple = malloc(sizeof(bignum_t) * PREGEN_DATA_COUNT);
+    uint64_t* d_even = malloc(sizeof(uint64_t) * PREGEN_DATA_COUNT);
+    if (!n_multiple || !d_even) {
+        perror("Failed to allocate memory for exact division");
+        return 1;
+    }
+    for (unsigned i = 0; i < PREGEN_DATA_COUNT; ++i) {
+        d_even[i] = (d_large[i] | 1) << (1 + rand() % 16);
+    }
+    const uint64_t *exact_classes[DIVISOR_CLASSES] = {d_small, d_large, d_even};
+    printf("\nExact division, len 1..%d (ns/call, speedup vs bignum_div_u64):\n", BIGNUM_CAPACITY);
+    printf("  %-10s %18s %18s %18s\n", "function", "d < 2^32", "d >= 2^32", "d even");
+    double ns_div[DIVISOR_CLASSES], ns_exact[DIVISOR_CLASSES];
+    for (int c = 0; c < DIVISOR_CLASSES; ++c) {
+        for (unsigned i = 0; i < PREGEN_DATA_COUNT; ++i) {
+            n_multiple[i] = n_sources[i];
+            make_multiple(&n_multiple[i], exact_classes[c][i]);
+        }
+        ns_div[c] = time_exact(n_multiple, exact_classes[c], false);
+        ns_exact[c] = time_exact(n_multiple, exact_classes[c], true);
+    }
+    printf("  %-10s", "div");
+    for (int c = 0; c < DIVISOR_CLASSES; ++c) printf(" %9.1f (%5.2fx)", ns_div[c], 1.0);
+    printf("\n  %-10s", "divexact");
+    for (int c = 0; c < DIVISOR_CLASSES; ++c) printf(" %9.1f (%5.2fx)", ns_exact[c], ns_div[c] / ns_exact[c]);
+    printf("\n");
+
+    // --- Фаза 5: Дерево остатков против одного прохода ---
+    static const size_t tree_lens[TREE_LENS] = {64, 256, 1024, 4096};
+    static const int tree_widths[TREE_WIDTHS] = {21, 32, 48, 64};
+    uint64_t* tree_n = malloc(sizeof(uint64_t) * tree_lens[TREE_LENS - 1]);
+    uint64_t* tree_d = malloc(sizeof(uint64_t) * TREE_MODULI);
+    uint64_t* tree_rem = malloc(sizeof(uint64_t) * TREE_MODULI);
+    uint64_t* tree_scratch = malloc(sizeof(uint64_t) * BIGNUM_MOD_U64_TREE_SCRATCH(tree_lens[TREE_LENS - 1]));
+    if (!tree_n || !tree_d || !tree_rem || !tree_scratch) {
+        perror("Failed to allocate memory for the remainder tree");
+        return 1;
+    }
+    for (size_t i = 0; i < tree_lens[TREE_LENS - 1]; ++i) {
+        tree_n[i] = ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 11) ^ (uint64_t)rand();
+    }
+    printf("\nRemainders by %d moduli (us/call, bignum_mod_u64_tree speedup vs bignum_mod_u64_multi_limbs):\n",
+           TREE_MODULI);
+    printf("  %-10s", "len");
+    for (int w = 0; w < TREE_WIDTHS; ++w) printf("        %2d-bit d", tree_widths[w]);
+    printf("\n");
+    for (int l = 0; l < TREE_LENS; ++l) {
+        printf("  %-10zu", tree_lens[l]);
+        for (int w = 0; w < TREE_WIDTHS; ++w) {
+            for (size_t j = 0; j < TREE_MODULI; ++j) {
+                uint64_t v = ((uint64_t)rand() << 33) ^ ((uint64_t)rand() << 11) ^ (uint64_t)rand();
+                tree_d[j] = (v >> (64 - tree_widths[w])) | (1ull << (tree_widths[w] - 1));
+            }
+            double us_pass = time_moduli(tree_n, tree_lens[l], tree_d, tree_rem, tree_scratch, false);
+            double us_tree = time_moduli(tree_n, tree_lens[l], tree_d, tree_rem, tree_scratch, true);
+            printf(" %8.0f (%5.2fx)", us_tree, us_pass / us_tree);
+        }
+        printf("\n");
+    }
+
+    // --- Фаза 6: Очистка ---
     free(n_sources);
     free(d_u64);
     free(rem_u64);
+    free(d_small);
+    free(d_large);
+    free(d_pow2);
+    free(n_multiple);
+    free(d_even);
+    free(tree_n);
+    free(tree_d);
+    free(tree_rem);
+    free(tree_scratch);
 
     return 0;
 }
@@ -15,6 +15,7 @@
  *   - rev 1.0 (12.08.2025): Первоначальная версия.
  *   - rev 1.1 (13.08.2025): Реализована предварительная генерация данных
  *                           в main для исключения rand() из потоков.
+ *   - rev 1.2 (15.10.2026): BIGNUM_CAPACITY и BIGNUM_BITS берутся из bignum.h.
  *
  * # Сборка
  * gcc -g -O2 -I include -no-pie -fno-omit-frame-pointer -pthread \
@@ -34,10 +35,6 @@
 #include <bignum.h>
 #include "bignum_div_u64.h"
 
-// --- Локальные определения для компиляции ---
-#define BIGNUM_CAPACITY 32
-#define BIGNUM_BITS (BIGNUM_CAPACITY * 64)
-
 #ifndef ITER_PER_THREAD
 #  define ITER_PER_THREAD (20000000u * 20)
 #endif
@@ -19,6 +19,39 @@
  *                         - Добавлен новый код ошибки BIGNUM_DIV_U64_ERR_BAD_LENGTH.
  *                         - Обновлена документация для отражения проверки n->len.
  *   - rev. 3 (26.11.2025): Removed version control functions.
+ *   - rev. 4 (15.10.2026): Добавлены контекст делителя bignum_div_u64_ctx_t,
+ *                         функции bignum_div_u64_ctx_init и bignum_div_u64_pre.
+ *   - rev. 5 (15.10.2026): Добавлена функция пакетного деления bignum_div_u64_batch.
+ *   - rev. 6 (15.10.2026): Добавлены bignum_mod_u64_ctx_t, bignum_mod_u64_ctx_init,
+ *                         bignum_mod_u64_pre и bignum_mod_u64 (только остаток).
+ *   - rev. 7 (15.10.2026): Добавлена функция bignum_mod_u64_multi (много делителей).
+ *   - rev. 8 (15.10.2026): Разрешено деление на месте (`q == n`).
+ *   - rev. 9 (15.10.2026): Выбор ядра во время выполнения: bignum_div_u64_kernel_t,
+ *                         bignum_div_u64_get_kernel, bignum_div_u64_set_kernel,
+ *                         bignum_div_u64_kernel_name; код BIGNUM_DIV_U64_ERR_UNSUPPORTED.
+ *   - rev. 10 (15.10.2026): Автонастройка: bignum_div_u64_autotune,
+ *                          bignum_div_u64_kernel_for, BIGNUM_DIV_U64_KERNEL_AUTOTUNED.
+ *   - rev. 11 (15.10.2026): Добавлена функция bignum_div_u64_limbs (массив слов любой длины).
+ *   - rev. 12 (15.10.2026): Типы bignum256_t..bignum8192_t и функции фиксированной
+ *                          ёмкости bignum_div_u64_256..bignum_div_u64_8192.
+ *   - rev. 13 (15.10.2026): Встраиваемый bignum_div_u64_inline для n->len <= 2.
+ *   - rev. 14 (15.10.2026): bignum_div_u64_unchecked и опция сборки BIGNUM_DIV_U64_CHECKED.
+ *   - rev. 15 (15.10.2026): bignum_div_u64_ex и флаги bignum_div_u64_flags_t.
+ *   - rev. 16 (15.10.2026): Ядро BIGNUM_DIV_U64_KERNEL_SMALL и маршрутизация малых делителей.
+ *   - rev. 17 (15.10.2026): Ядро BIGNUM_DIV_U64_KERNEL_SHIFT для делителей `2^k`.
+ *   - rev. 18 (16.10.2026): Встроенные таблицы: bignum_div_u64_pow10, bignum_div_u64_pow10_ctx,
+ *                          bignum_mod_u64_small_prime, bignum_mod_u64_small_primes.
+ *   - rev. 19 (16.10.2026): Добавлена функция bignum_divexact_u64 (точное деление).
+ *   - rev. 20 (16.10.2026): Проверка делимости: bignum_divisible_u64, bignum_divisible_u64_multi.
+ *   - rev. 21 (16.10.2026): Добавлена функция bignum_remove_factor_u64 (удаление множителя).
+ *   - rev. 22 (16.10.2026): Добавлена функция bignum_trial_divide (пробное деление).
+ *   - rev. 23 (16.10.2026): Дерево остатков bignum_mod_u64_tree.
+ *   - rev. 24 (16.10.2026): Деление на 128-битный делитель: bignum_u128_t, bignum_div_u128.
+ *   - rev. 25 (16.10.2026): Модули специального вида: bignum_mod_u64_pmersenne,
+ *                          bignum_mod_u64_mersenne, BIGNUM_MOD_U64_GOLDILOCKS_C.
+ *   - rev. 26 (16.10.2026): bignum_mod_u64: сумма слов для делителей `2^64 +- 1`.
+ *   - rev. 27 (16.10.2026): bignum_mod_u64_multi_limbs; bignum_mod_u64_tree строит
+ *                          дерево только там, где оно быстрее одного прохода.
  */
 
 #ifndef BIGNUM_DIV_U64_H
@@ -48,16 +81,92 @@ typedef enum {
     BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  = -2,
     BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    = -3,
     /** @brief Ошибка: длина входного числа n->len превышает BIGNUM_CAPACITY. */
-    BIGNUM_DIV_U64_ERR_BAD_LENGTH        = -4
+    BIGNUM_DIV_U64_ERR_BAD_LENGTH        = -4,
+    /** @brief Ошибка: запрошенное ядро не поддерживается процессором. */
+    BIGNUM_DIV_U64_ERR_UNSUPPORTED       = -5
 } bignum_div_u64_status_t;
 
+/**
+ * @brief Варианты ядра bignum_div_u64.
+ *
+ * @details
+ *   Все ядра дают одинаковый результат и коды состояния; различается только
+ *   скорость на конкретной микроархитектуре. Номера зафиксированы в
+ *   src/bignum_div_u64.inc.
+ */
+typedef enum {
+    BIGNUM_DIV_U64_KERNEL_HWDIV  = 0,  /**< Аппаратный `div r64`. */
+    BIGNUM_DIV_U64_KERNEL_PREINV = 1,  /**< Обратная величина, `mul`/`imul`. */
+    BIGNUM_DIV_U64_KERNEL_MULX   = 2,  /**< Обратная величина, BMI2 `mulx`. */
+    BIGNUM_DIV_U64_KERNEL_HALF   = 3,  /**< Полуслова, `div r32` при `d < 2^32`. */
+    BIGNUM_DIV_U64_KERNEL_SMALL  = 4,  /**< Цепочка остатков по два слова при `2 <= d < 2^32`. */
+    BIGNUM_DIV_U64_KERNEL_SHIFT  = 5,  /**< Сдвиг (AVX2 при наличии) при `d = 2^k`. */
+    BIGNUM_DIV_U64_KERNEL_COUNT,
+    /** Таблица ядер по корзинам, установленная bignum_div_u64_autotune(). */
+    BIGNUM_DIV_U64_KERNEL_AUTOTUNED = 0x7F
+} bignum_div_u64_kernel_t;
+
+/**
+ * @brief Флаги выходного контракта bignum_div_u64_ex (объединяются через `|`).
+ *
+ * @details Номера зафиксированы в src/bignum_div_u64.inc.
+ */
+typedef enum {
+    BIGNUM_DIV_U64_FLAG_NONE          = 0,  /**< Контракт bignum_div_u64. */
+    BIGNUM_DIV_U64_FLAG_NO_TAIL_CLEAR = 1,  /**< Не обнулять `q->words[q->len..]`. */
+    BIGNUM_DIV_U64_FLAG_REM_OPTIONAL  = 2,  /**< `rem` может быть `NULL`. */
+    BIGNUM_DIV_U64_FLAG_NO_NORMALIZE  = 4   /**< `q->len = n->len`, старшие нули не отбрасываются. */
+} bignum_div_u64_flags_t;
+
+/**
+ * @brief Предвычисленный контекст 64-битного делителя.
+ *
+ * @details
+ *   Заполняется функцией bignum_div_u64_ctx_init() один раз и затем
+ *   многократно используется bignum_div_u64_pre(). Поля считаются
+ *   внутренними; раскладка зафиксирована в src/bignum_div_u64.inc.
+ */
+typedef struct {
+    uint64_t d;      /**< Исходный делитель. */
+    uint64_t dnorm;  /**< Нормализованный делитель `d << shift`. */
+    uint64_t v;      /**< Обратная величина `floor((2^128 - 1) / dnorm) - 2^64`. */
+    uint64_t shift;  /**< Нормализующий сдвиг, число ведущих нулей `d`. */
+} bignum_div_u64_ctx_t;
+
+/**
+ * @brief Контекст делителя для вычисления остатка без частного.
+ *
+ * @details
+ *   Помимо обратной величины хранит таблицу `pow[i] = 2^(64*i) mod d`, по
+ *   которой bignum_mod_u64_pre() суммирует независимые произведения вместо
+ *   последовательной цепочки делений. Заполняется bignum_mod_u64_ctx_init().
+ */
+typedef struct {
+    bignum_div_u64_ctx_t div;            /**< Обратная величина для финального приведения. */
+    uint64_t pow[BIGNUM_CAPACITY];       /**< Степени `2^(64*i) mod d`. */
+} bignum_mod_u64_ctx_t;
+
+/**
+ * @name Числа фиксированной ёмкости
+ * @brief Раскладка совпадает с bignum_t: `words[C]`, затем `len`.
+ * @{
+ */
+typedef struct { uint64_t words[4];   int32_t len; } bignum256_t;   /**< 4 слова, 256 бит. */
+typedef struct { uint64_t words[8];   int32_t len; } bignum512_t;   /**< 8 слов, 512 бит. */
+typedef struct { uint64_t words[16];  int32_t len; } bignum1024_t;  /**< 16 слов, 1024 бита. */
+typedef struct { uint64_t words[32];  int32_t len; } bignum2048_t;  /**< 32 слова, 2048 бит. */
+typedef struct { uint64_t words[64];  int32_t len; } bignum4096_t;  /**< 64 слова, 4096 бит. */
+typedef struct { uint64_t words[128]; int32_t len; } bignum8192_t;  /**< 128 слов, 8192 бита. */
+/** @} */
+
 /**
  * @brief Выполняет деление большого беззнакового целого числа на 64-битное число.
  *
  * @details
  *   ### Алгоритм
  *   1.  **Валидация:** Проверяются входные указатели на `NULL`, делитель на ноль,
- *       а также буферы `q` и `n` на перекрытие.
+ *       а также буферы `q` и `n` на частичное перекрытие. Полное совпадение
+ *       (`q == n`) допускается: деление выполняется на месте.
  *   2.  **Проверка длины:** Проверяется, что `n->len` не превышает `BIGNUM_CAPACITY`.
  *   3.  **Инициализация:** Буфер результата `q` и остаток `rem` обнуляются.
  *   4.  **Длинное деление:** Выполняется пословное деление, начиная со старшего
@@ -75,11 +184,714 @@ typedef enum {
  * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
  * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
  * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Делитель `d` равен нулю.
- * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    Обнаружено перекрытие буферов `q` и `n`.
+ * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    Буферы `q` и `n` частично перекрываются.
  * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` превышает `BIGNUM_CAPACITY`.
  */
 bignum_div_u64_status_t bignum_div_u64(bignum_t *q, const bignum_t *n, const uint64_t d, uint64_t *rem);
 
+/**
+ * @brief Деление с флагами, ослабляющими выходной контракт bignum_div_u64.
+ *
+ * @details
+ *   С `flags == 0` эквивалентна bignum_div_u64. Флаги убирают работу,
+ *   результат которой вызывающему коду не нужен:
+ *   - BIGNUM_DIV_U64_FLAG_NO_TAIL_CLEAR: слова `q->words[q->len..]` не
+ *     трогаются (при `q == n` в них остаются слова делимого);
+ *   - BIGNUM_DIV_U64_FLAG_REM_OPTIONAL: `rem` может быть `NULL`;
+ *   - BIGNUM_DIV_U64_FLAG_NO_NORMALIZE: `q->len = n->len`, старшие слова
+ *     частного могут быть нулевыми.
+ *   Деление выполняется циклом `div r64` без выбора ядра.
+ *
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d      64-битный делитель.
+ * @param[out] rem    Указатель на остаток (`NULL` допускается с REM_OPTIONAL).
+ * @param[in]  flags  Комбинация bignum_div_u64_flags_t.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          `q`, `n` или (без REM_OPTIONAL) `rem` равен `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Делитель `d` равен нулю.
+ * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    Буферы `q` и `n` частично перекрываются.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ * @retval BIGNUM_DIV_U64_ERR_UNSUPPORTED       Неизвестные биты в `flags`.
+ */
+bignum_div_u64_status_t bignum_div_u64_ex(bignum_t *q, const bignum_t *n, uint64_t d, uint64_t *rem, unsigned flags);
+
+/**
+ * @brief Деление без проверки аргументов для горячих циклов.
+ *
+ * @details
+ *   Вызывающий код гарантирует контракт bignum_div_u64: `q`, `n` и `rem` не
+ *   `NULL`, `0 <= n->len <= BIGNUM_CAPACITY`, `d != 0`, `q` и `n` совпадают
+ *   или не перекрываются. Проверки и выбор ядра пропускаются: сразу
+ *   выполняется развёрнутый блок ядра hwdiv для `n->len`. Результат
+ *   совпадает с bignum_div_u64; нарушение контракта — неопределённое
+ *   поведение.
+ *
+ *   Сборка с `BIGNUM_DIV_U64_CHECKED` (`make CONFIG=debug` или `CHECKED=1`)
+ *   делает функцию проверяющей: она возвращает те же коды ошибок, что и
+ *   bignum_div_u64, и тесты ловят нарушения контракта.
+ *
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d      64-битный делитель (не ноль).
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t BIGNUM_DIV_U64_OK (в проверяющей сборке —
+ *         коды bignum_div_u64).
+ */
+bignum_div_u64_status_t bignum_div_u64_unchecked(bignum_t *q, const bignum_t *n, uint64_t d, uint64_t *rem);
+
+/**
+ * @brief Встраиваемый вариант bignum_div_u64 с быстрым путём для `n->len <= 2`.
+ *
+ * @details
+ *   Для корректных аргументов с `n->len <= 2` деление выполняется прямо в
+ *   вызывающем коде, без вызова, сохранения регистров и `rep stosq`.
+ *   Старшее слово делится на `d` обычным 64-битным делением (при
+ *   константном `d` компилятор заменяет его умножением). Шаг 128/64 на
+ *   GCC/Clang x86-64 — один `divq`: библиотечный `__udivti3` для
+ *   `unsigned __int128` медленнее самого вызова bignum_div_u64. На прочих
+ *   компиляторах используется `unsigned __int128`.
+ *   Результат (`q->words`, `q->len`, нулевой хвост, `*rem`)
+ *   совпадает с bignum_div_u64. Более длинные числа, ошибочные аргументы и
+ *   компиляторы без `__int128` обрабатываются вызовом bignum_div_u64.
+ *
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d      64-битный делитель.
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния, как у bignum_div_u64.
+ */
+static inline bignum_div_u64_status_t bignum_div_u64_inline(bignum_t *q, const bignum_t *n, uint64_t d, uint64_t *rem) {
+#if defined(__SIZEOF_INT128__)
+    if (q != NULL && n != NULL && rem != NULL && d != 0 && n->len >= 0 && n->len <= 2) {
+        uintptr_t qa = (uintptr_t)q, na = (uintptr_t)n;
+        if (qa == na || qa >= na + sizeof(bignum_t) || na >= qa + sizeof(bignum_t)) {
+            uint64_t n0 = (n->len > 0) ? n->words[0] : 0;
+            uint64_t n1 = (n->len > 1) ? n->words[1] : 0;
+            uint64_t q1 = n1 / d;
+            uint64_t r = n1 % d;
+            uint64_t q0;
+#if defined(__GNUC__) && defined(__x86_64__)
+            /* r < d: один divq вместо библиотечного __udivti3 */
+            __asm__("divq %[d]" : "=a"(q0), "+d"(r) : "a"(n0), [d] "rm"(d));
+#else
+            __extension__ typedef unsigned __int128 bignum_div_u64_u128_t;
+            q0 = (uint64_t)((((bignum_div_u64_u128_t)r << 64) | n0) / d);
+            r = n0 - q0 * d;  /* остаток < d: достаточно младших 64 бит */
+#endif
+            q->words[0] = q0;
+            q->words[1] = q1;
+            for (int i = 2; i < BIGNUM_CAPACITY; ++i) {
+                q->words[i] = 0;
+            }
+            q->len = (q1 != 0) ? 2 : (q0 != 0) ? 1 : 0;
+            *rem = r;
+            return BIGNUM_DIV_U64_OK;
+        }
+    }
+#endif
+    return bignum_div_u64(q, n, d, rem);
+}
+
+/**
+ * @brief Подготавливает контекст делителя для bignum_div_u64_pre().
+ *
+ * @details
+ *   Вычисляет нормализующий сдвиг и обратную величину делителя
+ *   (Möller–Granlund). Единственная инструкция `div` выполняется здесь,
+ *   а не при каждом делении.
+ *
+ * @param[out] ctx    Указатель на заполняемый контекст.
+ * @param[in]  d      64-битный делитель.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          `ctx` равен `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Делитель `d` равен нулю.
+ */
+bignum_div_u64_status_t bignum_div_u64_ctx_init(bignum_div_u64_ctx_t *ctx, uint64_t d);
+
+/**
+ * @brief Делит большое число на делитель из предвычисленного контекста.
+ *
+ * @details
+ *   Контракт `q`/`rem` и коды состояния совпадают с bignum_div_u64().
+ *   Основной цикл использует только умножения, поэтому выгоден, когда
+ *   один и тот же делитель применяется многократно.
+ *
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  ctx    Контекст, подготовленный bignum_div_u64_ctx_init().
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Контекст не инициализирован (`ctx->d == 0`).
+ * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    Буферы `q` и `n` частично перекрываются.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` превышает `BIGNUM_CAPACITY`.
+ */
+bignum_div_u64_status_t bignum_div_u64_pre(bignum_t *q, const bignum_t *n, const bignum_div_u64_ctx_t *ctx, uint64_t *rem);
+
+/**
+ * @brief Делит массив больших чисел на один 64-битный делитель.
+ *
+ * @details
+ *   Эквивалентно вызову bignum_div_u64(q[k], n[k], d, &rem[k]) для каждого k,
+ *   но обратная величина делителя вычисляется один раз, а числа
+ *   обрабатываются парами в одном цикле: две независимые цепочки остатков
+ *   перекрываются конвейером процессора.
+ *
+ *   Перед вычислениями проверяются все элементы; при ошибке ни один `q[k]`
+ *   и `rem[k]` не изменяется. Проверяется перекрытие только `q[k]` с `n[k]`
+ *   (`q[k] == n[k]` допускается); перекрытие между разными элементами не
+ *   допускается.
+ *
+ * @param[out] q      Массив из `count` указателей на частные.
+ * @param[in]  n      Массив из `count` указателей на делимые.
+ * @param[in]  count  Число элементов.
+ * @param[in]  d      64-битный делитель.
+ * @param[out] rem    Массив из `count` остатков.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Массив или один из его элементов равен `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Делитель `d` равен нулю.
+ * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    `q[k]` и `n[k]` частично перекрываются.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n[k]->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_div_u64_batch(bignum_t *q[], const bignum_t *n[], size_t count, uint64_t d, uint64_t *rem);
+
+/**
+ * @brief Делит массив слов произвольной длины на 64-битное число.
+ *
+ * @details
+ *   Низкоуровневый вариант bignum_div_u64 для буферов вызывающего кода, не
+ *   ограниченный `BIGNUM_CAPACITY`. Делимое — `len` слов, младшее слово
+ *   первым. В `q` записываются ровно `len` слов частного, включая старшие
+ *   нулевые; поле длины не пишется, за пределами `q[len-1]` память не
+ *   трогается. Деление выполняется умножением на обратную величину.
+ *
+ *   `q == n` допускается (деление на месте). При `len == 0` в `*rem`
+ *   записывается 0, а `q` и `n` не используются и могут быть `NULL`.
+ *
+ * @param[out] q      Буфер частного из `len` слов.
+ * @param[in]  n      Буфер делимого из `len` слов.
+ * @param[in]  len    Число слов.
+ * @param[in]  d      64-битный делитель.
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          `rem` равен `NULL` или `q`/`n` равен `NULL` при `len > 0`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Делитель `d` равен нулю.
+ * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    Буферы `q` и `n` частично перекрываются.
+ */
+bignum_div_u64_status_t bignum_div_u64_limbs(uint64_t *q, const uint64_t *n, size_t len, uint64_t d, uint64_t *rem);
+
+/**
+ * @brief Деление чисел фиксированной ёмкости: bignum_div_u64_<биты>(q, n, d, rem).
+ *
+ * @details
+ *   Семантика, проверки и коды состояния совпадают с bignum_div_u64, но
+ *   длина `n->len` ограничена ёмкостью типа, а хвост `q->words` обнуляется
+ *   до ёмкости типа. Все функции порождаются одним макросом с константной
+ *   ёмкостью; до 16 слов хвост обнуляется линейным кодом без цикла.
+ *   Деление выполняется умножением на обратную величину.
+ * @{
+ */
+bignum_div_u64_status_t bignum_div_u64_256(bignum256_t *q, const bignum256_t *n, uint64_t d, uint64_t *rem);
+bignum_div_u64_status_t bignum_div_u64_512(bignum512_t *q, const bignum512_t *n, uint64_t d, uint64_t *rem);
+bignum_div_u64_status_t bignum_div_u64_1024(bignum1024_t *q, const bignum1024_t *n, uint64_t d, uint64_t *rem);
+bignum_div_u64_status_t bignum_div_u64_2048(bignum2048_t *q, const bignum2048_t *n, uint64_t d, uint64_t *rem);
+bignum_div_u64_status_t bignum_div_u64_4096(bignum4096_t *q, const bignum4096_t *n, uint64_t d, uint64_t *rem);
+bignum_div_u64_status_t bignum_div_u64_8192(bignum8192_t *q, const bignum8192_t *n, uint64_t d, uint64_t *rem);
+/** @} */
+
+/**
+ * @brief Подготавливает контекст делителя для bignum_mod_u64_pre().
+ *
+ * @param[out] ctx    Указатель на заполняемый контекст.
+ * @param[in]  d      64-битный делитель.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          `ctx` равен `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Делитель `d` равен нулю.
+ */
+bignum_div_u64_status_t bignum_mod_u64_ctx_init(bignum_mod_u64_ctx_t *ctx, uint64_t d);
+
+/**
+ * @brief Вычисляет остаток `n mod d` по предвычисленному контексту.
+ *
+ * @details
+ *   Остаток считается как сумма `n->words[i] * pow[i]` по нескольким
+ *   независимым аккумуляторам с одним приведением в конце. Частное не
+ *   вычисляется. Правила проверки `n` и `rem` совпадают с bignum_div_u64().
+ *
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  ctx    Контекст, подготовленный bignum_mod_u64_ctx_init().
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Контекст не инициализирован.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_mod_u64_pre(const bignum_t *n, const bignum_mod_u64_ctx_t *ctx, uint64_t *rem);
+
+/**
+ * @brief Вычисляет остаток `n mod d` без вычисления частного.
+ *
+ * @details
+ *   Для разового делителя таблица степеней не окупается, поэтому здесь
+ *   выполняется цепочка умножений на обратную величину без записи частного
+ *   и обнуления хвоста. При многократном использовании одного делителя
+ *   выгоднее подготовить bignum_mod_u64_ctx_t и вызвать bignum_mod_u64_pre().
+ *   С 8 слов делители `2^64 - 1` и `2^64 + 1` (3, 5, 17, 257, 65537, 274177,
+ *   ...) распознаются, и остаток берётся от сумм чётных и нечётных слов.
+ *
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d      64-битный делитель.
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Делитель `d` равен нулю.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_mod_u64(const bignum_t *n, uint64_t d, uint64_t *rem);
+
+/**
+ * @brief Вычисляет остатки `rem[j] = n mod d[j]` для `k` делителей.
+ *
+ * @details
+ *   Слова `n` читаются один раз на группу из 32 делителей, и по каждому
+ *   слову продвигаются все независимые цепочки остатков группы, так что
+ *   их задержки перекрываются. Делители меньше 2^21 обрабатываются парами
+ *   в SSE2-полосах (точная арифметика double), остальные — умножением на
+ *   обратную величину. Все аргументы проверяются до записи в `rem`.
+ *
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d      Массив из `k` ненулевых 64-битных делителей.
+ * @param[in]  k      Число делителей (может быть 0).
+ * @param[out] rem    Массив из `k` элементов для записи остатков.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Один из делителей `d[j]` равен нулю.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_mod_u64_multi(const bignum_t *n, const uint64_t *d, size_t k, uint64_t *rem);
+
+/**
+ * @brief Вариант bignum_mod_u64_multi() для массива слов любой длины.
+ *
+ * @details
+ *   Тот же один проход по словам на группу делителей поверх массива слов,
+ *   как у bignum_div_u64_limbs(). Рабочая память не нужна.
+ *
+ * @param[in]  n      Делимое, `len` слов, младшее первым.
+ * @param[in]  len    Число слов `n` (при `len == 0` `n` может быть `NULL`).
+ * @param[in]  d      Массив из `k` ненулевых 64-битных делителей.
+ * @param[in]  k      Число делителей (может быть 0).
+ * @param[out] rem    Массив из `k` элементов для записи остатков.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          `d` или `rem` равен `NULL` или `n` равен `NULL` при `len > 0`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Один из делителей `d[j]` равен нулю.
+ */
+bignum_div_u64_status_t bignum_mod_u64_multi_limbs(const uint64_t *n, size_t len, const uint64_t *d, size_t k, uint64_t *rem);
+
+/** Наибольший показатель `k` в bignum_div_u64_pow10(): 10^19 < 2^64 < 10^20. */
+#define BIGNUM_DIV_U64_POW10_MAX     19
+
+/** Число простых в таблице bignum_mod_u64_small_primes (от 2 до 1619). */
+#define BIGNUM_MOD_U64_SMALL_PRIMES  256
+
+/**
+ * @brief Готовые контексты делителей `10^k`, `k = 0..BIGNUM_DIV_U64_POW10_MAX`.
+ *
+ * @details
+ *   Таблица только для чтения; элемент `k` можно передавать в
+ *   bignum_div_u64_pre() без вызова bignum_div_u64_ctx_init().
+ */
+extern const bignum_div_u64_ctx_t bignum_div_u64_pow10_ctx[BIGNUM_DIV_U64_POW10_MAX + 1];
+
+/** Первые BIGNUM_MOD_U64_SMALL_PRIMES простых по возрастанию: `[0] = 2`, `[1] = 3`, ... */
+extern const uint32_t bignum_mod_u64_small_primes[BIGNUM_MOD_U64_SMALL_PRIMES];
+
+/**
+ * @brief Делит большое число на `10^k` по встроенной таблице констант.
+ *
+ * @details
+ *   Обратные величины всех `10^k` посчитаны заранее, поэтому при вызове не
+ *   выполняется подготовка делителя. `10^1..10^9` при `n->len >= 16`
+ *   делятся цепочкой ядра small, остальные случаи — выбранным ядром
+ *   bignum_div_u64(): hwdiv получает `10^k` как есть, прочие ядра —
+ *   bignum_div_u64_pre() с bignum_div_u64_pow10_ctx.
+ *   Результат совпадает с `bignum_div_u64(q, n, 10^k, rem)`. Показатель `k`
+ *   проверяется первым, далее — как в bignum_div_u64().
+ *
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  k      Показатель, `0 <= k <= BIGNUM_DIV_U64_POW10_MAX`.
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    `q` и `n` частично перекрываются.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ * @retval BIGNUM_DIV_U64_ERR_UNSUPPORTED       `k > BIGNUM_DIV_U64_POW10_MAX`.
+ */
+bignum_div_u64_status_t bignum_div_u64_pow10(bignum_t *q, const bignum_t *n, unsigned k, uint64_t *rem);
+
+/**
+ * @brief Вычисляет остаток `n mod bignum_mod_u64_small_primes[idx]`.
+ *
+ * @details
+ *   Константы приведения всех простых таблицы посчитаны заранее. Остаток
+ *   продвигается по два слова за шаг без `div` и без записи частного.
+ *   Номер `idx` проверяется первым, далее — как в bignum_mod_u64().
+ *
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  idx    Номер простого, `0 <= idx < BIGNUM_MOD_U64_SMALL_PRIMES`.
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ * @retval BIGNUM_DIV_U64_ERR_UNSUPPORTED       `idx >= BIGNUM_MOD_U64_SMALL_PRIMES`.
+ */
+bignum_div_u64_status_t bignum_mod_u64_small_prime(const bignum_t *n, unsigned idx, uint64_t *rem);
+
+/**
+ * @brief Делит большое число на `d`, которое делит его нацело.
+ *
+ * @details
+ *   Частное вычисляется от младшего слова к старшему умножением на обратную
+ *   к нечётной части `d` по модулю 2^64, без `div` и без цепочки остатка;
+ *   степень двойки в `d` убирается сдвигом. Контракт `q` совпадает с
+ *   bignum_div_u64(): `q == n` допускается, `q->len` нормализуется, хвост
+ *   обнуляется. Если `d` не делит `n`, значение частного не определено.
+ *
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d      64-битный делитель, кратный которому `n`.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Попытка деления на ноль.
+ * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    `q` и `n` частично перекрываются.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_divexact_u64(bignum_t *q, const bignum_t *n, uint64_t d);
+
+/**
+ * @brief Проверяет, делится ли большое число на `d`, без вычисления частного.
+ *
+ * @details
+ *   Степень двойки в `d` проверяется по младшему слову, и при её отсутствии
+ *   ответ готов сразу. Нечётная часть `d'` проверяется двумя независимыми
+ *   цепочками, которые выполняются одновременно: младшая половина слов —
+ *   умножением на `d'^-1 mod 2^64`, старшая — остатком по обратной
+ *   величине. Частное не пишется ни в какой буфер.
+ *
+ * @param[in]  n          Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d          64-битный делитель.
+ * @param[out] divisible  Указатель на результат: `true`, если `d` делит `n`.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Попытка деления на ноль.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_divisible_u64(const bignum_t *n, uint64_t d, bool *divisible);
+
+/**
+ * @brief Проверяет делимость `n` на каждый из `k` делителей.
+ *
+ * @details
+ *   `divisible[j] = (n mod d[j] == 0)`. Делители обрабатываются группами
+ *   по четыре: каждое слово `n` читается один раз на группу, а цепочки
+ *   умножения на обратные по модулю 2^64 независимы и перекрываются; `div`
+ *   не выполняется. Все аргументы проверяются до записи в `divisible`.
+ *
+ * @param[in]  n          Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d          Массив из `k` ненулевых 64-битных делителей.
+ * @param[in]  k          Число делителей (может быть 0).
+ * @param[out] divisible  Массив из `k` результатов.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Один из делителей `d[j]` равен нулю.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_divisible_u64_multi(const bignum_t *n, const uint64_t *d, size_t k, bool *divisible);
+
+/**
+ * @brief Удаляет из `n` все вхождения множителя `p` и возвращает их число.
+ *
+ * @details
+ *   После вызова `n` не делится на `p`, а исходное значение равно
+ *   `n * p^count`. Степени `p, p^2, p^4, ...`, помещающиеся в 64 бита,
+ *   проверяются по четыре за один проход bignum_divisible_u64_multi(), и `n`
+ *   делится на месте на наибольшую подходящую степень bignum_divexact_u64(),
+ *   так что высокая кратность снимается за несколько проходов. Для
+ *   `p = 2^k` число сдвигается вправо за один проход. При `n = 0`
+ *   кратность равна 0, и `n` не меняется.
+ *
+ * @param[in,out] n      Указатель на `bignum_t`, из которого удаляется множитель.
+ * @param[in]     p      Удаляемый множитель, `p >= 2`.
+ * @param[out]    count  Указатель на кратность `p` в исходном `n`.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  `p == 0`.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ * @retval BIGNUM_DIV_U64_ERR_UNSUPPORTED       `p == 1` (кратность не определена).
+ */
+bignum_div_u64_status_t bignum_remove_factor_u64(bignum_t *n, uint64_t p, unsigned *count);
+
+/**
+ * @brief Пробное деление `n` на список 32-битных простых.
+ *
+ * @details
+ *   Подряд идущие `primes[j]` упаковываются в произведения меньше 2^64,
+ *   остатки `n` по 32 произведениям считаются за один проход
+ *   bignum_mod_u64_multi(), а остаток по каждому простому получается из
+ *   64-битного остатка его произведения одним делением. Так тысячи простых
+ *   проверяются за десятки проходов по `n` вместо тысяч.
+ *
+ *   Элементы `primes` не обязаны быть простыми — подойдут любые ненулевые
+ *   делители. `n = 0` делится на каждый.
+ *
+ * @param[in]  n        Указатель на `bignum_t`, представляющую проверяемое число.
+ * @param[in]  primes   Массив из `count` ненулевых делителей.
+ * @param[in]  count    Число делителей (может быть 0).
+ * @param[out] divisor  Первый по порядку `primes[j]`, делящий `n`, или 0.
+ * @param[out] bitmap   `NULL` — остановиться на первом делителе; иначе массив из
+ *                      `(count + 63) / 64` слов, в котором бит `j % 64` слова
+ *                      `j / 64` равен 1 тогда и только тогда, когда `primes[j] | n`.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          `n`, `primes` или `divisor` равен `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Один из `primes[j]` равен нулю.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_trial_divide(const bignum_t *n, const uint32_t *primes, size_t count, uint32_t *divisor, uint64_t *bitmap);
+
+/** Модулей в одном дереве bignum_mod_u64_tree() (синхронизировать с TREE_BLOCK). */
+#define BIGNUM_MOD_U64_TREE_BLOCK  64
+
+/** Размер рабочей памяти bignum_mod_u64_tree() в словах для делимого из `len` слов. */
+#define BIGNUM_MOD_U64_TREE_SCRATCH(len)  ((size_t)(len) + 12 * BIGNUM_MOD_U64_TREE_BLOCK + 2)
+
+/**
+ * @brief Вычисляет `rem[j] = n mod d[j]` для сотен и тысяч модулей деревом остатков.
+ *
+ * @details
+ *   Вариант bignum_mod_u64_multi() для длинных чисел и большого `k` поверх
+ *   массива слов, как у bignum_div_u64_limbs(). Модули берутся блоками по
+ *   BIGNUM_MOD_U64_TREE_BLOCK: для блока строится дерево произведений, `n`
+ *   один раз делится на корень, а остатки спускаются к листьям делением
+ *   остатка родителя на произведение узла. Длинная арифметика — школьное
+ *   умножение и деление Кнута, поэтому на корне приходится около одного
+ *   умножения на пару (слово `n`, модуль) — тот же порядок, что у одного
+ *   прохода bignum_mod_u64_multi_limbs(), и выигрыш только в константе.
+ *   Он растёт, когда модули короче 64 бит (корень из меньшего числа слов):
+ *   при 4096 словах около 1.05x для 64-битных модулей, 1.95x для 32-битных
+ *   и 2.6x для 21-битных. Блок, для которого дерево не быстрее (короткое `n`
+ *   при широких модулях), считается bignum_mod_u64_multi_limbs().
+ *
+ *   Блоки независимы: для параллельной обработки массив `d` можно разбить
+ *   между потоками, дав каждому свой `scratch`. Память не выделяется.
+ *
+ * @param[in]  n        Делимое, `len` слов, младшее первым.
+ * @param[in]  len      Число слов `n` (при `len == 0` `n` может быть `NULL`).
+ * @param[in]  d        Массив из `k` ненулевых 64-битных модулей.
+ * @param[in]  k        Число модулей (может быть 0).
+ * @param[out] rem      Массив из `k` элементов для записи остатков.
+ * @param[out] scratch  Рабочий буфер из BIGNUM_MOD_U64_TREE_SCRATCH(len) слов.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          `d`, `rem` или `scratch` равен `NULL` или `n` равен `NULL` при `len > 0`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Один из модулей `d[j]` равен нулю.
+ */
+bignum_div_u64_status_t bignum_mod_u64_tree(const uint64_t *n, size_t len, const uint64_t *d, size_t k, uint64_t *rem, uint64_t *scratch);
+
+/** 128-битное беззнаковое значение: `hi * 2^64 + lo`. */
+typedef struct {
+    uint64_t lo;    /**< Младшее слово. */
+    uint64_t hi;    /**< Старшее слово. */
+} bignum_u128_t;
+
+/**
+ * @brief Делит большое число на 128-битный делитель.
+ *
+ * @details
+ *   Контракт совпадает с bignum_div_u64(): те же коды состояния и порядок
+ *   проверок, `q == n` допускается, `q->len` нормализуется, хвост
+ *   `q->words` обнуляется. Для нормализованного делителя один раз
+ *   вычисляется обратная величина 3/2, и каждое слово частного получается
+ *   шагом из двух умножений без `div`. Делимое из двух слов и короче
+ *   делится одним `div` с уточнением, без обратной величины. При
+ *   `d.hi == 0` вызов передаётся bignum_div_u64().
+ *
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  d      128-битный делитель.
+ * @param[out] rem    Указатель на `bignum_u128_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  Делитель `d` равен нулю.
+ * @retval BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    Буферы `q` и `n` частично перекрываются.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ */
+bignum_div_u64_status_t bignum_div_u128(bignum_t *q, const bignum_t *n, bignum_u128_t d, bignum_u128_t *rem);
+
+/** Константа `c` простого Goldilocks `2^64 - 2^32 + 1 = 2^64 - c` для bignum_mod_u64_pmersenne(). */
+#define BIGNUM_MOD_U64_GOLDILOCKS_C  0xFFFFFFFFull
+
+/**
+ * @brief Вычисляет остаток `n mod (2^64 - c)` для малого `c`.
+ *
+ * @details
+ *   Так как `2^64 = c (mod 2^64 - c)`, каждое слово сворачивается
+ *   умножением на `c` со сложением, без `div`; с 8 слов четыре части `n`
+ *   сворачиваются независимо. `c` проверяется после `n->len`, далее — как в
+ *   bignum_mod_u64(). Простое Goldilocks — `c = BIGNUM_MOD_U64_GOLDILOCKS_C`.
+ *
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  c      Модуль `2^64 - c`, `1 <= c < 2^32`.
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ * @retval BIGNUM_DIV_U64_ERR_UNSUPPORTED       `c == 0` или `c >= 2^32`.
+ */
+bignum_div_u64_status_t bignum_mod_u64_pmersenne(const bignum_t *n, uint64_t c, uint64_t *rem);
+
+/**
+ * @brief Вычисляет остаток `n mod (2^k - 1)`, например по модулю `2^61 - 1`.
+ *
+ * @details
+ *   Свёртка та же, что в bignum_mod_u64_pmersenne(), с `c = 2^(64 mod k)`;
+ *   результат приводится сложением `k`-битных частей.
+ *
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[in]  k      Модуль `2^k - 1`, `2 <= k <= 64`.
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Успешное выполнение.
+ * @retval BIGNUM_DIV_U64_ERR_NULL_PTR          Один из входных указателей `NULL`.
+ * @retval BIGNUM_DIV_U64_ERR_BAD_LENGTH        Длина `n->len` вне диапазона.
+ * @retval BIGNUM_DIV_U64_ERR_UNSUPPORTED       `k < 2` или `k > 64`.
+ */
+bignum_div_u64_status_t bignum_mod_u64_mersenne(const bignum_t *n, unsigned k, uint64_t *rem);
+
+/**
+ * @brief Возвращает ядро, которым выполняется bignum_div_u64().
+ *
+ * @details
+ *   Ядро выбирается один раз по CPUID — при первом вызове bignum_div_u64()
+ *   или этой функции: `div r64` на Intel Ice Lake и AMD Zen 3 и новее, иначе
+ *   умножение на обратную величину (`mulx` при наличии BMI2). Делители `2^k`
+ *   дополнительно направляются в ядро shift, а длинные делимые при
+ *   `2 <= d < 2^32` — в ядро small (см. bignum_div_u64_kernel_for());
+ *   функция возвращает ядро для прочих вызовов.
+ *
+ * @return bignum_div_u64_kernel_t Номер выбранного ядра.
+ */
+bignum_div_u64_kernel_t bignum_div_u64_get_kernel(void);
+
+/**
+ * @brief Принудительно устанавливает ядро bignum_div_u64().
+ *
+ * @details
+ *   Предназначена для тестов и настройки под конкретную машину. Ядро
+ *   выполняет все вызовы: маршрутизация степеней двойки и малых делителей
+ *   и таблица автонастройки отключаются. Замена указателя атомарна, но вызывать
+ *   функцию следует до запуска потоков, выполняющих деление.
+ *
+ * @param[in]  kernel Номер ядра.
+ *
+ * @return bignum_div_u64_status_t Код состояния операции.
+ * @retval BIGNUM_DIV_U64_OK                    Ядро установлено.
+ * @retval BIGNUM_DIV_U64_ERR_UNSUPPORTED       Неверный номер или нет нужных
+ *                                              расширений (BMI2 для `mulx`).
+ */
+bignum_div_u64_status_t bignum_div_u64_set_kernel(bignum_div_u64_kernel_t kernel);
+
+/**
+ * @brief Возвращает имя ядра: "hwdiv", "preinv", "mulx", "half", "small", "shift" или "autotuned".
+ *
+ * @param[in]  kernel Номер ядра.
+ * @return const char* Имя ядра или "unknown" для неверного номера.
+ */
+const char *bignum_div_u64_kernel_name(bignum_div_u64_kernel_t kernel);
+
+/**
+ * @brief Подбирает ядро bignum_div_u64() замером на текущей машине.
+ *
+ * @details
+ *   Необязательная настройка. Каждое поддерживаемое ядро замеряется в шести
+ *   корзинах — длина делимого (`<= 4`, `<= 16`, больше) на размер делителя
+ *   (`d < 2^32` и больше); замер занимает доли миллисекунды. Победители
+ *   устанавливаются таблицей, после чего bignum_div_u64_get_kernel()
+ *   возвращает BIGNUM_DIV_U64_KERNEL_AUTOTUNED, а bignum_div_u64_set_kernel()
+ *   возвращает фиксированный выбор.
+ *
+ *   Если задан `cache_path`, результат сохраняется в файл (80 байт) с ключом
+ *   процессора (производитель, сигнатура CPUID и строка модели). При
+ *   следующем вызове с тем же файлом на том же процессоре таблица читается
+ *   без замеров. Ошибки чтения и записи файла не считаются ошибками
+ *   настройки. Вызывать следует до запуска потоков, выполняющих деление.
+ *
+ * @param[in]  cache_path Путь к файлу кэша или NULL.
+ *
+ * @return bignum_div_u64_status_t Всегда BIGNUM_DIV_U64_OK.
+ */
+bignum_div_u64_status_t bignum_div_u64_autotune(const char *cache_path);
+
+/**
+ * @brief Возвращает ядро, которым будет выполнено деление числа длины `len` на `d`.
+ *
+ * @details
+ *   Для делителей `d = 2^k` возвращает BIGNUM_DIV_U64_KERNEL_SHIFT. Для
+ *   прочих без автонастройки совпадает с bignum_div_u64_get_kernel(), кроме
+ *   делителей `2 <= d < 2^32` при `len >= 16` (если BIGNUM_CAPACITY не
+ *   меньше 16) — для них возвращается BIGNUM_DIV_U64_KERNEL_SMALL. После
+ *   bignum_div_u64_autotune() возвращает ядро корзины. Если ядро
+ *   установлено bignum_div_u64_set_kernel(), возвращает его.
+ *
+ * @param[in]  len Длина делимого в словах.
+ * @param[in]  d   Делитель.
+ * @return bignum_div_u64_kernel_t Номер ядра (не BIGNUM_DIV_U64_KERNEL_AUTOTUNED).
+ */
+bignum_div_u64_kernel_t bignum_div_u64_kernel_for(size_t len, uint64_t d);
+
 // --- API для отладки
 
 /**
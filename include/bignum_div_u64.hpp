@@ -0,0 +1,243 @@
+/**
+ * @file    bignum_div_u64.hpp
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   C++17: деление большого числа на делитель — константу времени компиляции.
+ *
+ * @details
+ *   bignum::div_by<D>(q, n, rem) делит `bignum_t` на литерал `D` без
+ *   вызова библиотеки и без `div`: нормализующий сдвиг, обратная величина и
+ *   прочие константы вычисляются `constexpr`, а цикл встраивается в
+ *   вызывающий код. Вариант цикла выбирается по `D` при компиляции:
+ *   - `D = 2^k` — сдвиг слов вправо, остаток — маска младшего слова;
+ *   - `D < 2^32` — цепочка остатков по два слова, как в ядре small:
+ *     r' = (r * (2^128 mod D) + K) mod D, слова частного — точным делением
+ *     на нечётную часть `D` (умножение на обратную по модулю 2^64);
+ *   - иначе — шаги 2/1 Möller–Granlund с константой v.
+ *
+ *   Контракт совпадает с bignum_div_u64: те же коды состояния и порядок
+ *   проверок, `q == n` допускается, `q->len` нормализуется, хвост
+ *   `q->words` обнуляется. `D == 0` отвергается при компиляции.
+ *
+ *   Требуются C++17 и `unsigned __int128` (GCC, Clang).
+ *
+ * @see     bignum_div_u64.h
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Первоначальная реализация.
+ */
+
+#ifndef BIGNUM_DIV_U64_HPP
+#define BIGNUM_DIV_U64_HPP
+
+#include "bignum_div_u64.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if __cplusplus < 201703L
+#  error "bignum_div_u64.hpp requires C++17"
+#endif
+
+#if !defined(__SIZEOF_INT128__)
+#  error "bignum_div_u64.hpp requires unsigned __int128"
+#endif
+
+namespace bignum {
+
+namespace detail {
+
+__extension__ typedef unsigned __int128 u128_t;
+
+/** Число ведущих нулей `x != 0`. */
+constexpr unsigned clz64(uint64_t x) noexcept {
+    unsigned n = 0;
+    while ((x & (uint64_t(1) << 63)) == 0) {
+        x <<= 1;
+        ++n;
+    }
+    return n;
+}
+
+/** Число младших нулей `x != 0`. */
+constexpr unsigned ctz64(uint64_t x) noexcept {
+    unsigned n = 0;
+    while ((x & 1) == 0) {
+        x >>= 1;
+        ++n;
+    }
+    return n;
+}
+
+/** Обратная к нечётному `d` по модулю 2^64 (Ньютон от 5 верных бит). */
+constexpr uint64_t inverse_mod_2_64(uint64_t d) noexcept {
+    uint64_t x = (3 * d) ^ 2;
+    for (int i = 0; i < 4; ++i) {
+        x *= 2 - d * x;
+    }
+    return x;
+}
+
+/** Константы делителя `D`, вычисляемые при компиляции. */
+template <uint64_t D>
+struct divisor_traits {
+    static_assert(D != 0, "bignum::div_by<0>: division by zero");
+
+    static constexpr bool power_of_two = (D & (D - 1)) == 0;
+    static constexpr bool small = D < (uint64_t(1) << 32);
+
+    // Шаг 2/1: dnorm = D << shift, v = floor((2^128 - 1) / dnorm) - 2^64
+    static constexpr unsigned shift = clz64(D);
+    static constexpr uint64_t dnorm = D << shift;
+    static constexpr uint64_t v = uint64_t(~u128_t(0) / dnorm);
+
+    // Цепочка по два слова (2 < D < 2^32, D не степень двойки)
+    static constexpr uint64_t m = uint64_t((u128_t(1) << 64) / D);
+    static constexpr uint64_t c1 = uint64_t((u128_t(1) << 64) % D);
+    static constexpr uint64_t c2 = uint64_t(u128_t(c1) * c1 % D);
+    static constexpr unsigned tz = ctz64(D);
+    static constexpr uint64_t inv = inverse_mod_2_64(D >> tz);
+};
+
+/** Шаг 2/1 Möller–Granlund: (r:u0) / dnorm, r < dnorm; r — остаток. */
+template <uint64_t D>
+inline uint64_t step_2by1(uint64_t &r, uint64_t u0) noexcept {
+    using T = divisor_traits<D>;
+    u128_t p = u128_t(T::v) * r + ((u128_t(r) << 64) | u0);
+    uint64_t q1 = uint64_t(p >> 64) + 1;
+    uint64_t rr = u0 - q1 * T::dnorm;
+    uint64_t mask = uint64_t(0) - uint64_t(rr > uint64_t(p));  // первая коррекция без ветвления
+    q1 += mask;
+    rr += mask & T::dnorm;
+    if (__builtin_expect(rr >= T::dnorm, 0)) {  // редкая вторая коррекция
+        ++q1;
+        rr -= T::dnorm;
+    }
+    r = rr;
+    return q1;
+}
+
+/** t mod D для D < 2^32: одно умножение на m и одна коррекция. */
+template <uint64_t D>
+inline uint64_t reduce(uint64_t t) noexcept {
+    using T = divisor_traits<D>;
+    t -= uint64_t((u128_t(t) * T::m) >> 64) * D;
+    return (t >= D) ? t - D : t;
+}
+
+/** Слово частного из r * 2^64 + n - r' = q * D точным делением. */
+template <uint64_t D>
+inline uint64_t exact_quotient(uint64_t n, uint64_t r_after, uint64_t r_before) noexcept {
+    using T = divisor_traits<D>;
+    uint64_t lo = n - r_after;
+    uint64_t hi = r_before - (n < r_after);
+    if constexpr (T::tz != 0) {
+        lo = (lo >> T::tz) | (hi << (64 - T::tz));
+    }
+    return lo * T::inv;
+}
+
+/** Деление слов n[0..len) на D в q[0..len); допускается q == n. */
+template <uint64_t D>
+inline uint64_t divide_words(uint64_t *q, const uint64_t *n, int len) noexcept {
+    using T = divisor_traits<D>;
+    if constexpr (T::power_of_two) {
+        constexpr unsigned k = T::tz;
+        uint64_t r = n[0] & (D - 1);
+        if constexpr (k == 0) {
+            for (int i = 0; i < len; ++i) q[i] = n[i];
+        } else {
+            for (int i = 0; i + 1 < len; ++i) q[i] = (n[i] >> k) | (n[i + 1] << (64 - k));
+            q[len - 1] = n[len - 1] >> k;
+        }
+        return r;
+    } else if constexpr (T::small) {
+        uint64_t r = 0;
+        int i = len;
+        if (i & 1) {
+            uint64_t w = n[--i];
+            uint64_t r1 = reduce<D>(w);
+            q[i] = exact_quotient<D>(w, r1, 0);
+            r = r1;
+        }
+        while (i >= 2) {
+            uint64_t w1 = n[i - 1], w0 = n[i - 2];
+            uint64_t a = reduce<D>(w1);
+            uint64_t k = reduce<D>(a * T::c1 + reduce<D>(w0));
+            uint64_t r1 = reduce<D>(r * T::c1 + a);
+            uint64_t r0 = reduce<D>(r * T::c2 + k);
+            q[i - 1] = exact_quotient<D>(w1, r1, r);
+            q[i - 2] = exact_quotient<D>(w0, r0, r1);
+            r = r0;
+            i -= 2;
+        }
+        return r;
+    } else {
+        constexpr unsigned s = T::shift;
+        uint64_t r = 0;
+        uint64_t hi = n[len - 1];
+        if constexpr (s != 0) r = hi >> (64 - s);
+        for (int i = len - 1; i > 0; --i) {
+            uint64_t lo = n[i - 1];
+            uint64_t u0 = hi;
+            if constexpr (s != 0) u0 = (hi << s) | (lo >> (64 - s));
+            q[i] = step_2by1<D>(r, u0);
+            hi = lo;
+        }
+        q[0] = step_2by1<D>(r, hi << s);
+        return r >> s;
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Делит большое число на константу `D` без вызова библиотеки.
+ *
+ * @tparam D          Делитель, `D != 0`.
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ * @param[out] rem    Указатель на `uint64_t` для записи остатка.
+ *
+ * @return bignum_div_u64_status_t Код состояния, как у bignum_div_u64
+ *         (кроме BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO: `D == 0` не компилируется).
+ */
+template <uint64_t D>
+inline bignum_div_u64_status_t div_by(bignum_t *q, const bignum_t *n, uint64_t *rem) noexcept {
+    if (q == nullptr || n == nullptr || rem == nullptr) return BIGNUM_DIV_U64_ERR_NULL_PTR;
+    int len = n->len;
+    if (len < 0 || len > BIGNUM_CAPACITY) return BIGNUM_DIV_U64_ERR_BAD_LENGTH;
+    uintptr_t qa = reinterpret_cast<uintptr_t>(q), na = reinterpret_cast<uintptr_t>(n);
+    if (qa != na && qa < na + sizeof(bignum_t) && na < qa + sizeof(bignum_t)) {
+        return BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP;
+    }
+
+    *rem = (len > 0) ? detail::divide_words<D>(q->words, n->words, len) : 0;
+    while (len > 0 && q->words[len - 1] == 0) --len;
+    q->len = len;
+    for (int i = len; i < BIGNUM_CAPACITY; ++i) {
+        q->words[i] = 0;
+    }
+    return BIGNUM_DIV_U64_OK;
+}
+
+/**
+ * @brief Вариант div_by без остатка.
+ *
+ * @tparam D          Делитель, `D != 0`.
+ * @param[out] q      Указатель на структуру `bignum_t` для записи частного.
+ * @param[in]  n      Указатель на `bignum_t`, представляющую делимое.
+ *
+ * @return bignum_div_u64_status_t Код состояния, как у div_by с остатком.
+ */
+template <uint64_t D>
+inline bignum_div_u64_status_t div_by(bignum_t *q, const bignum_t *n) noexcept {
+    uint64_t rem;
+    return div_by<D>(q, n, &rem);
+}
+
+} // namespace bignum
+
+#endif /* BIGNUM_DIV_U64_HPP */
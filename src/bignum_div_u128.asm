@@ -0,0 +1,350 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u128.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    16.10.2026
+;
+; @brief   Деление большого числа на 128-битный делитель.
+;
+; @details
+;   Реализует функцию bignum_div_u128 на ассемблере x86-64 (синтаксис YASM)
+;   в соответствии с System V AMD64 ABI.
+;
+;   Делитель d = d1 * 2^64 + d0 (d1 != 0) нормализуется сдвигом влево до
+;   старшего бита d1, для него один раз вычисляется обратная величина 3/2
+;   v = floor((2^192 - 1) / d) - 2^64 (Möller, Granlund, "Improved division
+;   by invariant integers", алгоритм 6), и каждое слово частного даёт шаг
+;   DIV_3BY2_PREINV: два умножения, остаток — два слова, без div. Делимое
+;   сдвигается на лету (shld), как в ядрах bignum_div_u64.
+;
+;   При d1 == 0 вызов передаётся bignum_div_u64.
+;
+; @history
+;   - rev. 1 (16.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+extern bignum_div_u64
+
+; =============================================================================
+; @brief  Шаг 3/2: (r1:r0:u0) / (d1:d0) при (r1:r0) < (d1:d0).
+;
+; @param  %1   [in]  u0 (регистр, кроме rax/rdx/r8–r11)
+; @param  r10  [in/out] r1, старшее слово остатка
+; @param  r11  [in/out] r0, младшее слово остатка
+; @param  r14  [in]  d1 (нормализованный)
+; @param  r15  [in]  d0
+; @param  rbx  [in]  v
+; @return r9 = слово частного
+; @clobbers rax, rdx, r8, flags
+; =============================================================================
+%macro DIV_3BY2_PREINV 1
+    mov     rax, rbx
+    mul     r10                         ; v * r1
+    add     rax, r11
+    adc     rdx, r10                    ; (q1:q0) = v * r1 + (r1:r0)
+    mov     r8, rax                     ; q0
+    mov     r9, rdx                     ; q1
+    imul    rdx, r14
+    sub     r11, rdx                    ; r1 = r0 - q1 * d1 (mod 2^64)
+    mov     rax, r15
+    mul     r9                          ; (t1:t0) = d0 * q1
+    sub     %1, rax
+    sbb     r11, rdx
+    sub     %1, r15
+    sbb     r11, r14                    ; (r1:r0) = (r1:u0) - (t1:t0) - (d1:d0)
+    mov     r10, r11
+    mov     r11, %1
+    inc     r9
+    cmp     r10, r8                     ; r1 >= q0: q1 -= 1, (r1:r0) += d
+    sbb     rax, rax
+    not     rax
+    add     r9, rax
+    mov     rdx, rax
+    and     rax, r15
+    and     rdx, r14
+    add     r11, rax
+    adc     r10, rdx
+    cmp     r10, r14                    ; редкая вторая коррекция: (r1:r0) >= d
+    jb      %%done
+    ja      %%fix
+    cmp     r11, r15
+    jb      %%done
+%%fix:
+    inc     r9
+    sub     r11, r15
+    sbb     r10, r14
+%%done:
+%endmacro
+
+section .text
+
+; =============================================================================
+; @brief      Делит n на 128-битный d: q = n / d, *rem = n % d.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: bignum_t *q             (Указатель на частное)
+;   - `rsi`: const bignum_t *n       (Указатель на делимое)
+;   - `rdx`: uint64_t d.lo           (bignum_u128_t d передаётся в rdx:rcx)
+;   - `rcx`: uint64_t d.hi
+;   - `r8`:  bignum_u128_t *rem      (Указатель на остаток)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** NULL, длина, d == 0, частичное перекрытие q и n —
+;       в порядке bignum_div_u64.
+;   2.  **d.hi == 0:** rem->hi = 0, переход в bignum_div_u64.
+;       **n->len <= 2:** одно слово частного делением (u2:u1) / d1 с
+;       уточнением по d0, без обратной величины.
+;   3.  **Нормализация** d и обратная величина 3/2 (один div).
+;   4.  **Цикл** от старшего слова: r = (0 : n[len-1] >> (64 - s)),
+;       q[i] = DIV_3BY2_PREINV(r, n'[i]); q == n допускается — слово n[i]
+;       прочитано до записи q[i].
+;   5.  **Остаток** сдвигается обратно; q->len нормализуется, хвост
+;       обнуляется.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11, xmm0
+; =============================================================================
+align 16
+global bignum_div_u128
+
+bignum_div_u128:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, 24
+
+    mov     r12, rdi    ; q
+    mov     r13, rsi    ; n
+    mov     r15, rdx    ; d0
+    mov     r14, rcx    ; d1
+    mov     [rsp], r8   ; rem
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      .err_null_ptr
+    test    r13, r13
+    jz      .err_null_ptr
+    test    r8, r8
+    jz      .err_null_ptr
+
+    mov     r9d, [r13 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+    mov     [rsp + 8], r9
+
+    mov     rax, r14
+    or      rax, r15
+    jz      .err_div_by_zero
+
+    cmp     r12, r13
+    je      .no_overlap
+    lea     rax, [r13 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r12, rax
+    jae     .no_overlap
+    lea     rax, [r12 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r13, rax
+    jb      .err_buffer_overlap
+.no_overlap:
+
+    ; 2. 64-битный делитель
+    test    r14, r14
+    jnz     .wide
+    mov     qword [r8 + 8], 0
+    mov     rdi, r12
+    mov     rsi, r13
+    mov     rdx, r15
+    mov     rcx, r8
+    add     rsp, 24
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    jmp     bignum_div_u64
+
+.wide:
+    ; 3. d <<= s; v = reciprocal_word(d1) с поправкой на d0
+    bsr     rcx, r14
+    xor     ecx, 63
+    shld    r14, r15, cl
+    shl     r15, cl
+    cmp     r9d, 2
+    jbe     .short
+
+    mov     rdx, r14
+    not     rdx
+    mov     rax, -1
+    div     r14
+    mov     rbx, rax                    ; v = floor((2^128 - 1) / d1) - 2^64
+    mov     rax, r14
+    imul    rax, rbx
+    add     rax, r15                    ; p = d1 * v + d0 (mod 2^64)
+    jnc     .p_done
+    dec     rbx
+    cmp     rax, r14
+    jb      .p_once
+    dec     rbx
+    sub     rax, r14
+.p_once:
+    sub     rax, r14
+.p_done:
+    mov     r8, rax
+    mov     rax, r15
+    mul     rbx                         ; (t1:t0) = d0 * v
+    add     r8, rdx
+    jnc     .v_done
+    dec     rbx
+    cmp     r8, r14
+    jb      .v_done
+    ja      .v_dec
+    cmp     rax, r15
+    jb      .v_done
+.v_dec:
+    dec     rbx
+.v_done:
+
+    ; 4. Цикл: rdi = i + 1, rsi = n[i], r10:r11 = остаток
+    xor     r10d, r10d
+    xor     r11d, r11d
+    mov     edi, r9d
+    test    edi, edi
+    jz      .remainder
+    mov     rsi, [r13 + rdi * 8 - 8]
+    shld    r11, rsi, cl                ; выдвинутые биты n[len-1]
+.div_loop:
+    dec     rdi
+    jz      .last_word
+    mov     rax, [r13 + rdi * 8 - 8]
+    mov     rbp, rsi
+    shld    rbp, rax, cl
+    mov     rsi, rax
+    DIV_3BY2_PREINV rbp
+    mov     [r12 + rdi * 8], r9
+    jmp     .div_loop
+.last_word:
+    mov     rbp, rsi
+    shl     rbp, cl
+    DIV_3BY2_PREINV rbp
+    mov     [r12], r9
+    jmp     .remainder
+
+    ; 3а. n->len <= 2: частное — одно слово, q^ = (u2:u1) / d1 уточняется
+    ;     по d0 (для делителя из двух слов оценка после этого точна)
+.short:
+    xor     r10d, r10d
+    xor     r11d, r11d
+    test    r9d, r9d
+    jz      .short_loaded
+    mov     r11, [r13]
+    cmp     r9d, 2
+    jb      .short_loaded
+    mov     r10, [r13 + 8]
+.short_loaded:
+    xor     edx, edx
+    shld    rdx, r10, cl                ; u2 < 2^s <= d1
+    mov     rax, r10
+    shld    rax, r11, cl                ; u1
+    mov     rsi, r11
+    shl     rsi, cl                     ; u0
+    div     r14
+    mov     r8, rax                     ; q^
+    mov     r10, rdx                    ; r^
+.short_adjust:
+    mov     rax, r8
+    mul     r15
+    cmp     rdx, r10
+    ja      .short_dec
+    jb      .short_done
+    cmp     rax, rsi
+    jbe     .short_done
+.short_dec:
+    dec     r8
+    add     r10, r14
+    jnc     .short_adjust
+.short_done:
+    mov     rax, r8
+    mul     r15
+    sub     rsi, rax
+    sbb     r10, rdx                    ; остаток = (r^ : u0) - q^ * d0
+    mov     r11, rsi
+    mov     [r12], r8
+    xor     r9d, r9d
+    test    r8, r8
+    setnz   r9b
+    mov     [rsp + 8], r9
+
+    ; 5. Остаток и нормализация частного
+.remainder:
+    mov     rdx, [rsp]
+    shrd    r11, r10, cl
+    shr     r10, cl
+    mov     [rdx], r11
+    mov     [rdx + 8], r10
+    mov     r9, [rsp + 8]
+.find_len:
+    test    r9, r9
+    jz      .set_len
+    cmp     qword [r12 + r9 * 8 - 8], 0
+    jne     .set_len
+    dec     r9
+    jmp     .find_len
+.set_len:
+    mov     [r12 + BIGNUM_LEN_OFFSET], r9d
+    ; хвост парами слов, как в bignum_divexact_u64
+    lea     rdi, [r12 + r9 * 8]
+    lea     rcx, [r12 + BIGNUM_CAPACITY * 8]
+    xorps   xmm0, xmm0
+    mov     eax, BIGNUM_CAPACITY
+    sub     eax, r9d
+    test    al, 1
+    jz      .clear_pairs
+    mov     qword [rdi], 0              ; нечётное число слов хвоста
+    add     rdi, 8
+.clear_pairs:
+    cmp     rdi, rcx
+    jae     .done
+    movups  [rdi], xmm0
+    add     rdi, 16
+    jmp     .clear_pairs
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.err_buffer_overlap:
+    mov     eax, BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP
+
+.exit:
+    ; --- Эпилог ---
+    add     rsp, 24
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
@@ -7,8 +7,11 @@
 ; @brief   Низкоуровневая реализация деления большого числа на uint64_t.
 ;
 ; @details
-;   Реализует функцию bignum_div_u64 на ассемблере x86-64 (синтаксис YASM)
-;   в соответствии с System V AMD64 ABI.
+;   Реализует ядро bignum_div_u64_hwdiv (аппаратный `div r64`) на ассемблере
+;   x86-64 (синтаксис YASM) в соответствии с System V AMD64 ABI. Публичный
+;   символ bignum_div_u64 выбирает ядро во время выполнения
+;   (см. bignum_div_u64_dispatch.asm). Точка входа bignum_div_u64_unchecked
+;   использует линейные блоки этого ядра без проверки аргументов.
 ;
 ;
 ; @history
@@ -22,12 +25,21 @@
 ;   - rev. 8 (09.08.2025): Финальная полировка: добавлена проверка на `n->len < 0` и исправлено обнуление `q` при `n->len == 0`.
 ;   - rev. 9 (09.08.2025): Финальная доработка документации в соответствии с QG. Восстановлена полная история, добавлены разделы "Алгоритм" и "Протокол вызова (ABI)".
 ;   - rev. 10 (26.11.2025): Removed version control functions and .data section
+;   - rev. 11 (15.10.2026): Константы и коды состояния вынесены в общий bignum_div_u64.inc.
+;   - rev. 12 (15.10.2026): Деление на месте (q == n) разрешено, частичное перекрытие отклоняется.
+;   - rev. 13 (15.10.2026): Функция переименована в ядро bignum_div_u64_hwdiv.
+;   - rev. 14 (15.10.2026): Цикл заменён развёрнутыми блоками для каждой длины
+;                           с переходом по таблице; хвост обнуляется без `rep stosq`
+;                           до цепочки `div`.
+;   - rev. 15 (15.10.2026): Точка входа bignum_div_u64_unchecked без проверок.
+;   - rev. 16 (16.10.2026): .len_table хранит 32-битные смещения вместо
+;                           абсолютных адресов (без DT_TEXTREL в PIE).
 ; -----------------------------------------------------------------------------
 
 section .text
 
 ; =============================================================================
-; @brief      Выполняет деление большого числа на uint64_t.
+; @brief      Выполняет деление большого числа на uint64_t инструкцией `div r64`.
 ;
 ; @details
 ;   ### Протокол вызова (ABI)
@@ -44,23 +56,24 @@ section .text
 ;       - Проверяются на NULL указатели `q`, `n`, `rem`.
 ;       - Проверяется длина `n->len` на отрицательные значения и превышение `BIGNUM_CAPACITY`.
 ;       - Проверяется делитель `d` на равенство нулю.
-;       - Проверяется перекрытие памяти между буферами `q` и `n`.
+;       - Проверяется перекрытие памяти между буферами `q` и `n`. Полное
+;         совпадение (`q == n`) допускается: слово `q->words[i]` пишется
+;         после чтения `n->words[i]`, а старшие слова уже не читаются.
 ;   3.  **Обработка тривиального случая:** Если `n->len` равен 0, буфер `q`
 ;       полностью обнуляется, `rem` устанавливается в 0, и функция успешно завершается.
-;   4.  **Основной цикл:**
-;       - Цикл выполняется от старшего слова делимого (`n->words[n->len - 1]`) к младшему.
-;       - На каждой итерации 128-битное число, составленное из остатка
-;         предыдущей итерации (`current_rem`) и текущего слова `n`, делится
-;         на `d` с помощью аппаратной инструкции `div`.
-;       - Полученная часть частного записывается в `q->words`.
-;       - Индекс старшего ненулевого слова частного определяется "на лету"
-;         с помощью инструкции `cmovnz` для избежания ветвлений.
-;   5.  **Установка длины частного:** Длина `q->len` вычисляется без ветвления
-;       на основе найденного индекса с помощью инструкции `lea`.
-;   6.  **Ленивое обнуление:** Обнуляется только неиспользуемый "хвост"
-;       буфера `q`, начиная с `q->words[q->len]`.
-;   7.  **Запись остатка:** Финальный остаток из `current_rem` записывается в `*rem`.
-;   8.  **Эпилог:** Восстанавливаются callee-saved регистры, возвращается код состояния.
+;   4.  **Линейный блок:** по таблице `.len_table` выполняется переход к
+;       блоку для данного `n->len`, развёрнутому при сборке (HWDIV_LEN_BLOCK):
+;       - Хвост `q->words[n->len..BIGNUM_CAPACITY-1]` обнуляется
+;         фиксированным набором записей `movups` до цепочки `div`: записи
+;         не зависят от деления и исполняются в её тени (при q == n эти
+;         слова `n` не читаются).
+;       - `n->len` шагов `div` от старшего слова к младшему без счётчика
+;         цикла; остаток каждого шага переходит в следующий через `rdx`.
+;       - Частное записывается в `q->words`.
+;   5.  **Установка длины частного:** `q->len` определяется по старшему слову
+;       частного; цикл поиска нужен только для делимого со старшими нулями.
+;   6.  **Запись остатка:** Остаток последнего шага записывается в `*rem`.
+;   7.  **Эпилог:** Восстанавливаются callee-saved регистры, возвращается код состояния.
 ;
 ; @abi        System V AMD64 ABI
 ; @param[in]  rdi: bignum_t *q        (Указатель на структуру для частного)
@@ -74,26 +87,76 @@ section .text
 ; @retval -2 – division by zero
 ; @retval -3 – buffer overlap
 ; @retval -4 – bad length 
-; @clobbers   rbx, r8–r15, rcx, rdx
+; @clobbers   r8–r11, rcx, rdx, xmm0
 ; =============================================================================
-; --- Константы ---
-%define BIGNUM_CAPACITY 32
-%define BIGNUM_LEN_OFFSET (BIGNUM_CAPACITY * 8)
-; sizeof(bignum_t) в C = 256 (words) + 4 (len) + 4 (padding) = 264
-%define BIGNUM_T_SIZE_ALIGNED 264
-
-; --- Коды состояния ---
-%define BIGNUM_DIV_U64_OK                    0
-%define BIGNUM_DIV_U64_ERR_NULL_PTR          -1
-%define BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO  -2
-%define BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP    -3
-%define BIGNUM_DIV_U64_ERR_BAD_LENGTH        -4
+%include "bignum_div_u64.inc"
+
+; =============================================================================
+; @brief  Линейный блок деления для n->len = %1.
+;
+; @details
+;   Добавляет своё смещение от .len_table в таблицу (секция .rodata; без
+;   абсолютных адресов, не требует перемещений при загрузке PIE) и выполняет
+;   %1 шагов `div` без счётчика цикла. Хвост q->words[%1..BIGNUM_CAPACITY-1]
+;   обнуляется фиксированным набором 16-байтных записей перед цепочкой `div`:
+;   начиная с %1 = 7 время вызова определяется латентностью `div`, и записи,
+;   поставленные после неё, задерживали отставку блока. q->len = %1, если
+;   старшее слово частного не ноль, иначе %1 - 1; если и слово %1 - 2 нулевое
+;   (делимое со старшими нулями), длина ищется в .scan_len.
+;
+; @param  %1  длина делимого (1..BIGNUM_CAPACITY)
+; @clobbers rax, rcx, rdx, r8, xmm0, flags
+; =============================================================================
+%macro HWDIV_LEN_BLOCK 1
+section .rodata
+    dd      %%entry - .len_table
+section .text
+%%entry:
+    ; Хвост частного известен статически
+    xorps   xmm0, xmm0
+%assign HWDIV_I %1
+%rep (BIGNUM_CAPACITY - %1) / 2
+    movups  [r12 + HWDIV_I * 8], xmm0
+%assign HWDIV_I HWDIV_I + 2
+%endrep
+%if (BIGNUM_CAPACITY - %1) % 2
+    mov     qword [r12 + HWDIV_I * 8], 0
+%endif
+
+    xor     edx, edx
+    mov     rax, [r13 + (%1 - 1) * 8]
+    div     r14
+    mov     [r12 + (%1 - 1) * 8], rax
+    mov     r8, rax                     ; старшее слово частного
+%assign HWDIV_I %1 - 2
+%rep %1 - 1
+    mov     rax, [r13 + HWDIV_I * 8]
+    div     r14
+    mov     [r12 + HWDIV_I * 8], rax
+%assign HWDIV_I HWDIV_I - 1
+%endrep
+    mov     [r15], rdx
+
+    ; q->len по старшему слову частного
+    mov     ecx, %1
+    test    r8, r8
+    jnz     %%len_ok
+    dec     ecx
+%if %1 > 1
+    cmp     qword [r12 + (%1 - 2) * 8], 0
+    je      .scan_len
+%endif
+%%len_ok:
+    mov     [r12 + BIGNUM_LEN_OFFSET], ecx
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+%endmacro
 
 section .text
 align 16
-global bignum_div_u64
+global bignum_div_u64_hwdiv
 
-bignum_div_u64:
+bignum_div_u64_hwdiv:
     ; --- Пролог ---
     push    r12
     push    r13
@@ -123,7 +186,9 @@ bignum_div_u64:
     test    r14, r14 ; d == 0?
     jz      .err_div_by_zero
 
-    ; Проверка перекрытия буферов
+    ; Проверка перекрытия буферов (q == n допустимо: деление на месте)
+    cmp     r12, r13
+    je      .no_overlap
     mov     rax, r12
     lea     rcx, [r13 + BIGNUM_T_SIZE_ALIGNED]
     cmp     rax, rcx
@@ -137,12 +202,13 @@ bignum_div_u64:
     jmp     .exit
 .no_overlap:
 
-    ; 2. Инициализация rem и проверка тривиального случая
-    mov     qword [r15], 0
+    ; 2. Проверка тривиального случая (остаток пишет линейный блок)
     test    r9, r9
     jnz     .main_logic
 
-    ; Обработка n->len == 0: полное обнуление q
+.zero_len:
+    ; Обработка n->len == 0: полное обнуление q, rem = 0
+    mov     qword [r15], 0
     xor     rax, rax
     mov     ecx, BIGNUM_T_SIZE_ALIGNED / 8
     mov     rdi, r12
@@ -151,42 +217,30 @@ bignum_div_u64:
     jmp     .exit
 
 .main_logic:
-    ; 4. Оптимизированный цикл (деление + нормализация)
-    xor     r8, r8      ; current_rem = 0
-    mov     r10, -1     ; q_len_idx = -1
-.main_loop:
-    dec     r9
-    mov     rax, [r13 + r9 * 8]
-    mov     rdx, r8
-    div     r14
-    mov     [r12 + r9 * 8], rax
-    mov     r8, rdx
-
-    ; Обновление q_len_idx без ветвления
-    mov     rcx, r9
-    cmp     r10, -1
-    jne     .no_len_update
-    test    rax, rax
-    cmovnz  r10, rcx
-.no_len_update:
-    test    r9, r9
-    jnz     .main_loop
-
-    ; 5. Установка финальной длины q->len без ветвления
-    lea     r11d, [r10 + 1]
-    mov     [r12 + BIGNUM_LEN_OFFSET], r11d
+    ; 4. Переход к линейному блоку для n->len
+    lea     rcx, [rel .len_table]
+    movsxd  rax, dword [rcx + r9 * 4 - 4]
+    add     rax, rcx
+    jmp     rax
 
-    ; 6. Ленивое обнуление "хвоста" буфера q
-    mov     rcx, BIGNUM_CAPACITY
-    sub     rcx, r11
-    jz      .finalize
-    lea     rdi, [r12 + r11 * 8]
-    xor     rax, rax
-    rep     stosq
+section .rodata
+align 4
+.len_table:                             ; смещения блоков для n->len = 1..BIGNUM_CAPACITY
+section .text
+%assign HWDIV_LEN 1
+%rep BIGNUM_CAPACITY
+    HWDIV_LEN_BLOCK HWDIV_LEN
+%assign HWDIV_LEN HWDIV_LEN + 1
+%endrep
 
-.finalize:
-    ; 7. Финальный остаток
-    mov     [r15], r8
+.scan_len:
+    ; Делимое со старшими нулевыми словами: поиск q->len ниже ecx
+    dec     ecx
+    jz      .set_len
+    cmp     qword [r12 + rcx * 8 - 8], 0
+    je      .scan_len
+.set_len:
+    mov     [r12 + BIGNUM_LEN_OFFSET], ecx
     mov     eax, BIGNUM_DIV_U64_OK
     jmp     .exit
 
@@ -208,4 +262,43 @@ bignum_div_u64:
     pop     r14
     pop     r13
     pop     r12
-    ret
\ No newline at end of file
+    ret
+
+; =============================================================================
+; @brief      Деление без проверки аргументов (bignum_div_u64_unchecked).
+;
+; @details
+;   Аргументы должны удовлетворять контракту bignum_div_u64: указатели не
+;   NULL, 0 <= n->len <= BIGNUM_CAPACITY, d != 0, q и n не перекрываются
+;   частично. После пролога управление сразу передаётся линейным блокам
+;   ядра hwdiv (таблица .len_table), минуя проверки и выбор ядра.
+;
+;   При сборке с -DBIGNUM_DIV_U64_CHECKED (CONFIG=debug) символ ведёт на
+;   полную проверку bignum_div_u64_hwdiv и возвращает коды ошибок.
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: bignum_t *q, rsi: const bignum_t *n, rdx: uint64_t d,
+;             rcx: uint64_t *rem
+; @return     rax: BIGNUM_DIV_U64_OK (с проверками: 0, -1, -2, -3, -4)
+; @clobbers   r8–r11, rcx, rdx, xmm0
+; =============================================================================
+align 16
+global bignum_div_u64_unchecked
+
+bignum_div_u64_unchecked:
+%ifdef BIGNUM_DIV_U64_CHECKED
+    jmp     bignum_div_u64_hwdiv
+%else
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    mov     r12, rdi    ; q
+    mov     r13, rsi    ; n
+    mov     r14, rdx    ; d
+    mov     r15, rcx    ; rem
+    mov     r9d, [r13 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    jnz     bignum_div_u64_hwdiv.main_logic
+    jmp     bignum_div_u64_hwdiv.zero_len
+%endif
@@ -0,0 +1,317 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_autotune.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Автонастройка выбора ядра bignum_div_u64 замером на месте.
+;
+; @details
+;   Реализует функцию bignum_div_u64_autotune на ассемблере x86-64
+;   (синтаксис YASM) в соответствии с System V AMD64 ABI.
+;
+;   CPUID не различает хосты виртуальных машин, на которых `div r64` то
+;   быстрее, то медленнее умножения на обратную величину. Поэтому каждое
+;   поддерживаемое ядро замеряется (`rdtsc`, минимум из AT_REPEATS серий по
+;   AT_CALLS вызовов) в каждой из TUNE_BUCKETS корзин, и победители
+;   устанавливаются таблицей через bignum_div_u64_install_tuned. Ядро
+;   shift не замеряется: степени двойки таблица направляет в него сама.
+;
+;   Результат можно сохранить в файл (80 байт): сигнатура AT_MAGIC, ключ
+;   процессора (производитель, сигнатура CPUID.1:EAX, строка модели) и
+;   номера ядер по корзинам. При совпадении ключа таблица загружается без
+;   замеров. Файл читается и пишется системными вызовами Linux, чтобы
+;   модуль не зависел от libc.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+;   - rev. 2 (15.10.2026): Ядро shift исключено из замеров.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+%define AT_REPEATS          5
+%define AT_CALLS            16
+
+; --- Запись кэша ---
+%define REC_MAGIC_OFFSET    0
+%define REC_KEY_OFFSET      8
+%define REC_BRAND_OFFSET    24      ; строка модели CPUID 0x80000002..4
+%define REC_TABLE_OFFSET    72
+%define REC_SIZE            80
+
+; --- Системные вызовы Linux x86-64 ---
+%define SYS_READ            0
+%define SYS_WRITE           1
+%define SYS_OPEN            2
+%define SYS_CLOSE           3
+%define O_RDONLY            0
+%define O_WRONLY_CREAT_TRUNC 0x241
+%define O_CLOEXEC           0x80000
+%define CACHE_FILE_MODE     0x1A4               ; 0644
+
+; --- Кадр стека ---
+%define F_PATH      0
+%define F_BUCKET    8
+%define F_KERNEL    16
+%define F_BEST_T    24
+%define F_BEST_K    32
+%define F_REPEAT    40
+%define F_REM       48
+%define F_REC       64                              ; запись кэша (REC_SIZE)
+%define F_FILE      (F_REC + REC_SIZE)              ; прочитанная запись
+%define F_N         (F_FILE + REC_SIZE)             ; bignum_t
+%define F_Q         (F_N + BIGNUM_T_SIZE_ALIGNED)   ; bignum_t
+%define FRAME_SIZE  (F_Q + BIGNUM_T_SIZE_ALIGNED + 8)
+
+extern bignum_div_u64
+extern bignum_div_u64_set_kernel
+extern bignum_div_u64_install_tuned
+
+section .rodata
+align 8
+at_magic:   db "BDU64AT1"
+; Представительные длины классов и делители (10^9 < 2^32 <= 10^19)
+at_lens:    dq 3, 10, BIGNUM_CAPACITY
+at_divs:    dq 1000000000, 10000000000000000000
+
+section .text
+
+; =============================================================================
+; @brief  Читает отметку времени (rdtsc после lfence).
+; @return rax = TSC
+; @clobbers rdx
+; =============================================================================
+%macro READ_TSC 0
+    lfence
+    rdtsc
+    shl     rdx, 32
+    or      rax, rdx
+%endmacro
+
+; =============================================================================
+; @brief      Настраивает таблицу ядер bignum_div_u64 замером или из кэша.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const char *cache_path  (Путь к файлу кэша или NULL)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Ключ:** собирается запись с сигнатурой и ключом процессора.
+;   2.  **Кэш:** если файл читается целиком, сигнатура и ключ совпадают, а
+;       номера ядер допустимы, таблица устанавливается без замеров.
+;   3.  **Замер:** для каждой корзины делимое длины at_lens[класс] делится
+;       на at_divs[класс] каждым поддерживаемым ядром; выбирается ядро с
+;       наименьшим временем серии.
+;   4.  **Установка и запись:** таблица устанавливается, запись
+;       сохраняется в файл (ошибки записи игнорируются: кэш необязателен).
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_autotune
+
+bignum_div_u64_autotune:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, FRAME_SIZE
+    mov     [rsp + F_PATH], rdi
+
+    ; 1. Сигнатура и ключ процессора
+    lea     r8, [rsp + F_REC]
+    mov     rax, [rel at_magic]
+    mov     [r8 + REC_MAGIC_OFFSET], rax
+    xor     eax, eax
+    cpuid
+    mov     [r8 + REC_KEY_OFFSET], ebx
+    mov     [r8 + REC_KEY_OFFSET + 4], edx
+    mov     [r8 + REC_KEY_OFFSET + 8], ecx
+    mov     eax, 1
+    cpuid
+    mov     [r8 + REC_KEY_OFFSET + 12], eax
+    lea     rdi, [r8 + REC_BRAND_OFFSET]
+    xor     eax, eax
+    mov     ecx, (REC_SIZE - REC_BRAND_OFFSET) / 8
+    rep     stosq                           ; строка модели и таблица = 0
+    mov     eax, 0x80000000
+    cpuid
+    cmp     eax, 0x80000004
+    jb      .key_ready
+    mov     r9d, 0x80000002
+    lea     r10, [r8 + REC_BRAND_OFFSET]
+.brand_loop:
+    mov     eax, r9d
+    cpuid
+    mov     [r10], eax
+    mov     [r10 + 4], ebx
+    mov     [r10 + 8], ecx
+    mov     [r10 + 12], edx
+    add     r10, 16
+    inc     r9d
+    cmp     r9d, 0x80000004
+    jbe     .brand_loop
+.key_ready:
+
+    ; 2. Попытка загрузить таблицу из кэша
+    mov     rdi, [rsp + F_PATH]
+    test    rdi, rdi
+    jz      .tune
+    mov     eax, SYS_OPEN
+    mov     esi, O_RDONLY | O_CLOEXEC
+    xor     edx, edx
+    syscall
+    test    rax, rax
+    js      .tune
+    mov     rbx, rax                        ; fd
+    mov     edi, ebx
+    lea     rsi, [rsp + F_FILE]
+    mov     edx, REC_SIZE
+    mov     eax, SYS_READ
+    syscall
+    mov     r12, rax
+    mov     edi, ebx
+    mov     eax, SYS_CLOSE
+    syscall
+    cmp     r12, REC_SIZE
+    jne     .tune
+    lea     rsi, [rsp + F_REC]
+    lea     rdi, [rsp + F_FILE]
+    mov     ecx, REC_TABLE_OFFSET
+    repe    cmpsb
+    jne     .tune
+    lea     rdi, [rsp + F_FILE + REC_TABLE_OFFSET]
+    call    bignum_div_u64_install_tuned
+    test    eax, eax
+    jz      .done
+
+    ; 3. Замер ядер по корзинам
+.tune:
+    lea     rdi, [rsp + F_N]
+    mov     rax, 0x9E3779B97F4A7C15
+    mov     ecx, BIGNUM_CAPACITY
+.fill_loop:
+    mov     rdx, rax
+    shl     rdx, 13
+    xor     rax, rdx
+    mov     rdx, rax
+    shr     rdx, 7
+    xor     rax, rdx
+    mov     rdx, rax
+    shl     rdx, 17
+    xor     rax, rdx
+    stosq
+    dec     ecx
+    jnz     .fill_loop
+
+    mov     qword [rsp + F_BUCKET], 0
+.bucket_loop:
+    mov     rax, [rsp + F_BUCKET]
+    xor     edx, edx
+    mov     ecx, TUNE_LEN_CLASSES
+    div     rcx                             ; rax = класс делителя, rdx = класс длины
+    lea     rcx, [rel at_lens]
+    mov     rcx, [rcx + rdx * 8]
+    mov     [rsp + F_N + BIGNUM_LEN_OFFSET], ecx
+    lea     rcx, [rel at_divs]
+    mov     r15, [rcx + rax * 8]            ; делитель корзины
+    mov     qword [rsp + F_BEST_T], -1
+    mov     qword [rsp + F_BEST_K], KERNEL_PREINV
+    mov     qword [rsp + F_KERNEL], 0
+
+.kernel_loop:
+    mov     rdi, [rsp + F_KERNEL]
+    cmp     rdi, KERNEL_SHIFT
+    je      .kernel_next
+    call    bignum_div_u64_set_kernel
+    test    eax, eax
+    jnz     .kernel_next
+
+    ; Прогрев
+    lea     rdi, [rsp + F_Q]
+    lea     rsi, [rsp + F_N]
+    mov     rdx, r15
+    lea     rcx, [rsp + F_REM]
+    call    bignum_div_u64
+
+    mov     r14, -1                         ; лучшая серия ядра
+    mov     qword [rsp + F_REPEAT], AT_REPEATS
+.repeat_loop:
+    READ_TSC
+    mov     r13, rax
+    mov     ebx, AT_CALLS
+.call_loop:
+    lea     rdi, [rsp + F_Q]
+    lea     rsi, [rsp + F_N]
+    mov     rdx, r15
+    lea     rcx, [rsp + F_REM]
+    call    bignum_div_u64
+    dec     ebx
+    jnz     .call_loop
+    READ_TSC
+    sub     rax, r13
+    cmp     rax, r14
+    cmovb   r14, rax
+    dec     qword [rsp + F_REPEAT]
+    jnz     .repeat_loop
+
+    cmp     r14, [rsp + F_BEST_T]
+    jae     .kernel_next
+    mov     [rsp + F_BEST_T], r14
+    mov     rax, [rsp + F_KERNEL]
+    mov     [rsp + F_BEST_K], rax
+.kernel_next:
+    inc     qword [rsp + F_KERNEL]
+    cmp     qword [rsp + F_KERNEL], KERNEL_COUNT
+    jb      .kernel_loop
+
+    mov     rax, [rsp + F_BUCKET]
+    mov     rcx, [rsp + F_BEST_K]
+    mov     [rsp + F_REC + REC_TABLE_OFFSET + rax], cl
+    inc     rax
+    mov     [rsp + F_BUCKET], rax
+    cmp     rax, TUNE_BUCKETS
+    jb      .bucket_loop
+
+    ; 4. Установка таблицы и запись кэша
+    lea     rdi, [rsp + F_REC + REC_TABLE_OFFSET]
+    call    bignum_div_u64_install_tuned
+
+    mov     rdi, [rsp + F_PATH]
+    test    rdi, rdi
+    jz      .done
+    mov     eax, SYS_OPEN
+    mov     esi, O_WRONLY_CREAT_TRUNC | O_CLOEXEC
+    mov     edx, CACHE_FILE_MODE
+    syscall
+    test    rax, rax
+    js      .done
+    mov     rbx, rax
+    mov     edi, ebx
+    lea     rsi, [rsp + F_REC]
+    mov     edx, REC_SIZE
+    mov     eax, SYS_WRITE
+    syscall
+    mov     edi, ebx
+    mov     eax, SYS_CLOSE
+    syscall
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+
+    ; --- Эпилог ---
+    add     rsp, FRAME_SIZE
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
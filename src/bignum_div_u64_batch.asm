@@ -0,0 +1,309 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_batch.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Пакетное деление массива больших чисел на один uint64_t.
+;
+; @details
+;   Реализует функцию bignum_div_u64_batch на ассемблере x86-64 (синтаксис
+;   YASM) в соответствии с System V AMD64 ABI. Числа обрабатываются парами:
+;   две независимые цепочки остатков продвигаются в одном цикле, и
+;   внеочередное исполнение перекрывает их задержки.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+;   - rev. 2 (15.10.2026): Деление на месте (q[k] == n[k]).
+;   - rev. 3 (16.10.2026): Полоса без пары не дублируется в B.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+; --- Кадр стека ---
+%define F_Q_ARR     0       ; bignum_t *q[]
+%define F_N_ARR     8       ; const bignum_t *n[]
+%define F_REM_ARR   16      ; uint64_t *rem
+%define F_COUNT     24      ; size_t count
+%define F_K         32      ; индекс первой полосы текущей пары
+%define F_QA        40      ; q полосы A
+%define F_QB        48      ; q полосы B
+%define F_REMA      56      ; &rem[A]
+%define F_REMB      64      ; &rem[B]
+%define F_LENA      72      ; n->len полосы A
+%define F_LENB      80      ; n->len полосы B
+%define F_SHIFT     88      ; нормализующий сдвиг
+%define FRAME_SIZE  96
+
+section .text
+
+; =============================================================================
+; @brief      Делит count больших чисел на один 64-битный делитель.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: bignum_t *q[]        (Массив указателей на частные)
+;   - `rsi`: const bignum_t *n[]  (Массив указателей на делимые)
+;   - `rdx`: size_t count         (Число элементов)
+;   - `rcx`: uint64_t d           (64-битный делитель)
+;   - `r8`:  uint64_t *rem        (Массив из count остатков)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** проверяются массивы и делитель, затем каждый элемент
+;       (NULL, длина, частичное перекрытие `q[k]` и `n[k]`; `q[k] == n[k]`
+;       допускается). При ошибке ничего не
+;       записывается.
+;   2.  **Обратная величина:** нормализованный делитель и `v` вычисляются
+;       один раз на весь пакет (PREINV_SETUP).
+;   3.  **Пары:** элементы k и k+1 образуют полосы A и B. Полоса A — более
+;       длинная; она одна проходит старшие слова, затем обе полосы идут в
+;       ногу шагами DIV_2BY1_PREINV, не зависящими друг от друга. Полоса без
+;       пары (последний элемент при нечётном count или пара с пустой B)
+;       проходит solo-цикл до слова 0 и делится ровно один раз.
+;   4.  **Завершение:** остатки денормализуются, длины частных нормализуются,
+;       хвосты обнуляются (FINISH_QUOTIENT).
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_batch
+
+bignum_div_u64_batch:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, FRAME_SIZE
+
+    ; 1. Валидация аргументов
+    test    rdi, rdi
+    jz      .err_null_ptr
+    test    rsi, rsi
+    jz      .err_null_ptr
+    test    r8, r8
+    jz      .err_null_ptr
+    test    rcx, rcx
+    jz      .err_div_by_zero
+
+    mov     [rsp + F_Q_ARR], rdi
+    mov     [rsp + F_N_ARR], rsi
+    mov     [rsp + F_REM_ARR], r8
+    mov     [rsp + F_COUNT], rdx
+
+    ; Валидация элементов до любой записи
+    xor     r9d, r9d
+.validate_loop:
+    cmp     r9, rdx
+    jae     .validated
+    mov     r10, [rdi + r9 * 8]             ; q[k]
+    mov     r11, [rsi + r9 * 8]             ; n[k]
+    test    r10, r10
+    jz      .err_null_ptr
+    test    r11, r11
+    jz      .err_null_ptr
+    mov     eax, [r11 + BIGNUM_LEN_OFFSET]
+    test    eax, eax
+    js      .err_bad_length
+    cmp     eax, BIGNUM_CAPACITY
+    jg      .err_bad_length
+    cmp     r10, r11
+    je      .validate_next                  ; деление на месте
+    lea     rax, [r11 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r10, rax
+    jge     .validate_next
+    lea     rax, [r10 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r11, rax
+    jl      .err_buffer_overlap
+.validate_next:
+    inc     r9
+    jmp     .validate_loop
+
+.validated:
+    ; 2. Обратная величина делителя на весь пакет
+    mov     r14, rcx
+    PREINV_SETUP r14, rbx                   ; r14 = dnorm, rbx = v, rcx = shift
+    mov     [rsp + F_SHIFT], rcx
+    xor     eax, eax
+
+    ; 3. Цикл по парам
+.pair_loop:
+    mov     [rsp + F_K], rax
+    cmp     rax, [rsp + F_COUNT]
+    jae     .done
+
+    mov     rsi, [rsp + F_N_ARR]
+    mov     rdi, [rsp + F_Q_ARR]
+    mov     r15, [rsp + F_REM_ARR]
+    mov     r12, [rsi + rax * 8]            ; nA
+    mov     r10, [rdi + rax * 8]            ; qA
+    lea     r8, [r15 + rax * 8]             ; &rem[A]
+    mov     r9d, [r12 + BIGNUM_LEN_OFFSET]  ; lenA
+    lea     rdx, [rax + 1]
+    cmp     rdx, [rsp + F_COUNT]
+    jae     .lone_lane                      ; нечётный хвост: A без пары
+    mov     r13, [rsi + rdx * 8]            ; nB
+    mov     r11, [rdi + rdx * 8]            ; qB
+    lea     r15, [r15 + rdx * 8]            ; &rem[B]
+    mov     ebp, [r13 + BIGNUM_LEN_OFFSET]  ; lenB
+
+    ; Полоса A должна быть не короче полосы B
+    cmp     r9, rbp
+    jae     .lanes_ordered
+    xchg    r12, r13
+    xchg    r10, r11
+    xchg    r8, r15
+    xchg    r9, rbp
+.lanes_ordered:
+    test    rbp, rbp
+    jnz     .lanes_ready
+
+    ; Пустая полоса B: q обнуляется целиком, A проходит одна
+    mov     qword [r15], 0
+    mov     rdi, r11
+    mov     ecx, BIGNUM_T_SIZE_ALIGNED / 8
+    xor     eax, eax
+    rep     stosq
+    mov     rcx, [rsp + F_SHIFT]
+
+.lone_lane:
+    ; Полоса A без пары: solo-цикл до слова 0 (rbp = 0)
+    xor     ebp, ebp
+    test    r9, r9
+    jnz     .lanes_ready
+    mov     qword [r8], 0
+    mov     rdi, r10
+    mov     ecx, BIGNUM_T_SIZE_ALIGNED / 8
+    xor     eax, eax
+    rep     stosq
+    mov     rcx, [rsp + F_SHIFT]
+    jmp     .next_pair
+
+.lanes_ready:
+    mov     [rsp + F_QA], r10
+    mov     [rsp + F_QB], r11
+    mov     [rsp + F_REMA], r8
+    mov     [rsp + F_REMB], r15
+    mov     [rsp + F_LENA], r9
+    mov     [rsp + F_LENB], rbp
+
+    ; Полоса A: начальный остаток из старшего слова
+    dec     r9                              ; i = lenA - 1
+    mov     rsi, [r12 + r9 * 8]             ; curA
+    xor     r8d, r8d
+    shld    r8, rsi, cl                     ; remA
+
+    ; Старшие слова, которых нет у полосы B (i >= lenB); без пары lenB = 0
+.solo_loop:
+    cmp     r9, rbp
+    jb      .paired_start
+    test    r9, r9
+    jz      .lone_last_word
+    mov     rdi, [r12 + r9 * 8 - 8]
+    shld    rsi, rdi, cl
+    DIV_2BY1_PREINV rdi, r8, rsi, r14, rbx
+    mov     [r10 + r9 * 8], rdi
+    mov     rsi, [r12 + r9 * 8 - 8]
+    dec     r9
+    jmp     .solo_loop
+
+    ; Последнее слово полосы без пары
+.lone_last_word:
+    shl     rsi, cl
+    DIV_2BY1_PREINV rbp, r8, rsi, r14, rbx
+    mov     [r10], rbp
+    shr     r8, cl
+    mov     rax, [rsp + F_REMA]
+    mov     [rax], r8
+    mov     r9, [rsp + F_LENA]
+    FINISH_QUOTIENT r10, r9
+    mov     rcx, [rsp + F_SHIFT]
+    jmp     .next_pair
+
+.paired_start:
+    ; Полоса B вступает на индексе i = lenB - 1
+    mov     rdi, [r13 + r9 * 8]             ; curB
+    xor     r15d, r15d
+    shld    r15, rdi, cl                    ; remB
+    test    r9, r9
+    jz      .last_word
+
+    ; Две независимые цепочки в одном цикле
+.paired_loop:
+    mov     rbp, [r12 + r9 * 8 - 8]
+    shld    rsi, rbp, cl
+    DIV_2BY1_PREINV rbp, r8, rsi, r14, rbx
+    mov     [r10 + r9 * 8], rbp
+    mov     rsi, [r12 + r9 * 8 - 8]
+
+    mov     rbp, [r13 + r9 * 8 - 8]
+    shld    rdi, rbp, cl
+    DIV_2BY1_PREINV rbp, r15, rdi, r14, rbx
+    mov     [r11 + r9 * 8], rbp
+    mov     rdi, [r13 + r9 * 8 - 8]
+
+    dec     r9
+    jnz     .paired_loop
+
+.last_word:
+    shl     rsi, cl
+    DIV_2BY1_PREINV rbp, r8, rsi, r14, rbx
+    mov     [r10], rbp
+    shl     rdi, cl
+    DIV_2BY1_PREINV rbp, r15, rdi, r14, rbx
+    mov     [r11], rbp
+
+    ; 4. Остатки и нормализация частных
+    shr     r8, cl
+    shr     r15, cl
+    mov     rax, [rsp + F_REMA]
+    mov     [rax], r8
+    mov     rax, [rsp + F_REMB]
+    mov     [rax], r15
+
+    mov     r9, [rsp + F_LENA]
+    FINISH_QUOTIENT r10, r9
+    mov     r9, [rsp + F_LENB]
+    FINISH_QUOTIENT r11, r9
+    mov     rcx, [rsp + F_SHIFT]
+
+.next_pair:
+    mov     rax, [rsp + F_K]
+    add     rax, 2
+    jmp     .pair_loop
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.err_buffer_overlap:
+    mov     eax, BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP
+    jmp     .exit
+
+.exit:
+    ; --- Эпилог ---
+    add     rsp, FRAME_SIZE
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
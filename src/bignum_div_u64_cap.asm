@@ -0,0 +1,181 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_cap.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Семейство функций деления для фиксированных ёмкостей 4..128 слов.
+;
+; @details
+;   Реализует функции bignum_div_u64_256 ... bignum_div_u64_8192 на
+;   ассемблере x86-64 (синтаксис YASM) в соответствии с System V AMD64 ABI.
+;   Все функции порождаются одним макросом DIV_U64_CAP; раскладка числа
+;   ёмкости C совпадает с bignum_t: `uint64_t words[C]; int32_t len;`,
+;   размер 8 * C + 8 байт.
+;
+;   Ёмкость известна при сборке, поэтому смещение len, размер структуры и
+;   проверка перекрытия — константы. При C <= CAP_STRAIGHT_MAX хвост
+;   q->words[n->len..C-1] обнуляется до деления линейным кодом без ветвлений
+;   (C шагов load/cmov/store) вместо запуска `rep stosq`.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+; =============================================================================
+; @brief  Функция деления для ёмкости %1 слов с символом bignum_div_u64_%2.
+;
+; @details
+;   Порядок проверок совпадает с bignum_div_u64: NULL, длина, ноль,
+;   частичное перекрытие (q == n допускается). Деление — PREINV_DIV_CORE.
+;
+;   Линейное обнуление хвоста: для каждого i слово q->words[i] читается и
+;   записывается обратно, если i < n->len, иначе записывается 0. Слова
+;   i < n->len затем перезаписываются частным; при q == n они ещё не
+;   прочитаны делением и сохраняются без изменений.
+;
+; @param  %1  ёмкость в словах
+; @param  %2  ёмкость в битах (суффикс символа)
+; =============================================================================
+%macro DIV_U64_CAP 2
+align 16
+global bignum_div_u64_%2
+
+bignum_div_u64_%2:
+    ; --- Пролог ---
+    push    rbx
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+
+    mov     r12, rdi    ; q
+    mov     r13, rsi    ; n
+    mov     r14, rdx    ; d
+    mov     r15, rcx    ; rem
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      %%err_null_ptr
+    test    r13, r13
+    jz      %%err_null_ptr
+    test    r15, r15
+    jz      %%err_null_ptr
+
+    mov     r9d, [r13 + %1 * 8]
+    test    r9d, r9d
+    js      %%err_bad_length
+    cmp     r9d, %1
+    jg      %%err_bad_length
+
+    test    r14, r14
+    jz      %%err_div_by_zero
+
+    cmp     r12, r13
+    je      %%no_overlap
+    lea     rax, [r13 + %1 * 8 + 8]
+    cmp     r12, rax
+    jae     %%no_overlap
+    lea     rax, [r12 + %1 * 8 + 8]
+    cmp     r13, rax
+    jb      %%err_buffer_overlap
+%%no_overlap:
+
+    mov     qword [r15], 0
+%if %1 <= CAP_STRAIGHT_MAX
+    ; 2. Линейное обнуление хвоста q->words[n->len..C-1]
+    xor     eax, eax
+%assign CAP_I 0
+%rep %1
+    mov     rdx, [r12 + CAP_I * 8]
+    cmp     r9d, CAP_I
+    cmovbe  rdx, rax                    ; i >= n->len -> 0
+    mov     [r12 + CAP_I * 8], rdx
+%assign CAP_I CAP_I + 1
+%endrep
+    mov     r11, r9
+    test    r9, r9
+    jz      %%set_len
+%else
+    ; 2. Тривиальный случай n->len == 0
+    mov     r11, r9
+    test    r9, r9
+    jnz     %%main_logic
+    xor     eax, eax
+    mov     ecx, %1 + 1
+    mov     rdi, r12
+    rep     stosq
+    jmp     %%done
+%%main_logic:
+%endif
+
+    ; 3. Обратная величина и цикл
+    PREINV_SETUP r14, rbx               ; r14 = dnorm, rbx = v, rcx = shift
+    PREINV_DIV_CORE 0
+
+    ; 4. Длина частного (и хвост для больших ёмкостей)
+%%find_len:
+    test    r11, r11
+    jz      %%set_len
+    cmp     qword [r12 + r11 * 8 - 8], 0
+    jne     %%set_len
+    dec     r11
+    jmp     %%find_len
+%%set_len:
+    mov     [r12 + %1 * 8], r11d
+%if %1 > CAP_STRAIGHT_MAX
+    mov     ecx, %1
+    sub     ecx, r11d
+    jz      %%done
+    lea     rdi, [r12 + r11 * 8]
+    xor     eax, eax
+    rep     stosq
+%endif
+
+%%done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     %%exit
+
+%%err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     %%exit
+
+%%err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     %%exit
+
+%%err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     %%exit
+
+%%err_buffer_overlap:
+    mov     eax, BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP
+
+%%exit:
+    ; --- Эпилог ---
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbx
+    ret
+%endmacro
+
+section .text
+
+; =============================================================================
+; @brief      bignum_div_u64_<биты>(q, n, d, rem) для ёмкостей 4..128 слов.
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: q, rsi: n, rdx: uint64_t d, rcx: uint64_t *rem
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+DIV_U64_CAP 4, 256
+DIV_U64_CAP 8, 512
+DIV_U64_CAP 16, 1024
+DIV_U64_CAP 32, 2048
+DIV_U64_CAP 64, 4096
+DIV_U64_CAP 128, 8192
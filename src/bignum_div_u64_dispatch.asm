@@ -0,0 +1,555 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_dispatch.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Выбор ядра bignum_div_u64 во время выполнения по CPUID.
+;
+; @details
+;   Публичный символ bignum_div_u64 — переход по указателю на ядро. До
+;   первого вызова указатель ведёт на заглушку, которая один раз опрашивает
+;   CPUID, выбирает ядро и продолжает вызов в нём; далее каждый вызов стоит
+;   одного косвенного `jmp`. Выбор:
+;   - быстрый `div r64` (Intel Ice Lake и новее, AMD Zen 3 и новее) — hwdiv;
+;   - иначе при BMI2 — mulx;
+;   - иначе — preinv.
+;   Ядро half автоматически не выбирается: оно выигрывает только на малых
+;   делителях и устанавливается вручную (bignum_div_u64_set_kernel).
+;
+;   Перед выбранным ядром стоит маршрутизатор dispatch_routed: делители
+;   d = 2^k (и d = 0, для кода ошибки) уходят в ядро shift, делители
+;   2 <= d < 2^32 при n->len >= SMALL_MIN_LEN — в ядро small (если порог не
+;   больше BIGNUM_CAPACITY). Таблица автонастройки так же пропускает
+;   степени двойки в shift. Явно установленное ядро
+;   (bignum_div_u64_set_kernel) маршрутизацию отключает.
+;
+;   Для ядра shift при наличии AVX2 (и поддержке ymm в XCR0) в таблицу
+;   ядер один раз записывается вариант bignum_div_u64_shift_avx2.
+;
+;   Указатель и номер ядра — выровненные 8-байтовые слова, их запись атомарна.
+;   Гонка двух потоков при первом вызове безопасна: оба записывают одно и
+;   то же значение.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+;   - rev. 2 (15.10.2026): Таблица ядер по корзинам длины и делителя
+;                          (bignum_div_u64_autotune), bignum_div_u64_kernel_for.
+;   - rev. 3 (15.10.2026): Ядро small и маршрутизация малых делителей.
+;   - rev. 4 (15.10.2026): Ядро shift для делителей-степеней двойки.
+;   - rev. 5 (16.10.2026): bignum_div_u64_ctx_dispatch для готовых контекстов.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+%define VENDOR_INTEL    0x756E6547      ; "Genu"
+%define VENDOR_AMD      0x68747541      ; "Auth"
+%define AMD_ZEN3_FAMILY 0x19
+%define KERNEL_NAME_LEN 8
+%define CPUID1_ECX_OSXSAVE_AVX  0x18000000  ; биты 27 и 28
+%define XCR0_SSE_AVX            6
+
+extern bignum_div_u64_hwdiv
+extern bignum_div_u64_preinv
+extern bignum_div_u64_mulx
+extern bignum_div_u64_half
+extern bignum_div_u64_small
+extern bignum_div_u64_shift
+extern bignum_div_u64_shift_avx2
+extern bignum_div_u64_pre
+
+section .data
+align 8
+dispatch_impl:      dq dispatch_lazy            ; текущее ядро
+dispatch_kernel:    dq -1                       ; его номер, -1 — не выбрано
+dispatch_bmi2:      dq -1                       ; BMI2: 1/0, -1 — не опрошено
+dispatch_base:      dq 0                        ; ядро вне маршрутов
+dispatch_table:     dq bignum_div_u64_hwdiv
+                    dq bignum_div_u64_preinv
+                    dq bignum_div_u64_mulx
+                    dq bignum_div_u64_half
+                    dq bignum_div_u64_small
+                    dq bignum_div_u64_shift     ; или _avx2 (dispatch_detect)
+tuned_ptrs:         times TUNE_BUCKETS dq 0     ; ядра по корзинам
+tuned_ids:          times TUNE_BUCKETS dq 0     ; их номера
+
+section .rodata
+align 8
+; Модели Intel семейства 6 с быстрым делителем: Ice Lake (0x6A, 0x6C, 0x7D,
+; 0x7E), Tiger Lake (0x8C, 0x8D), Sapphire/Emerald Rapids (0x8F, 0xCF),
+; Alder/Raptor Lake (0x97, 0x9A, 0xB7, 0xBA, 0xBF), Rocket Lake (0xA7),
+; Meteor Lake (0xAA, 0xAC), Granite Rapids (0xAD, 0xAE), Lunar Lake (0xBD),
+; Arrow Lake (0xC5, 0xC6).
+fast_div_models:    dq 0x0000000000000000
+                    dq 0x6000140000000000
+                    dq 0xA48074800480B000
+                    dq 0x0000000000008060
+kernel_names:       db "hwdiv", 0, 0, 0
+                    db "preinv", 0, 0
+                    db "mulx", 0, 0, 0, 0
+                    db "half", 0, 0, 0, 0
+                    db "small", 0, 0, 0
+                    db "shift", 0, 0, 0
+kernel_name_none:   db "unknown", 0
+kernel_name_tuned:  db "autotuned", 0
+
+section .text
+
+; =============================================================================
+; @brief  Опрашивает CPUID и выбирает ядро по умолчанию.
+;
+; @details
+;   Заполняет dispatch_bmi2 и выбирает вариант ядра shift. Не изменяет
+;   dispatch_impl.
+;
+; @return rax = номер ядра
+; @clobbers rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+dispatch_detect:
+    push    rbx
+
+    xor     eax, eax
+    cpuid
+    mov     r8d, eax                    ; максимальный лист
+    mov     r9d, ebx                    ; первые 4 байта производителя
+
+    mov     eax, 1
+    cpuid
+    mov     r11d, ecx                   ; OSXSAVE, AVX
+    mov     esi, eax
+    shr     esi, 8
+    and     esi, 0xF                    ; базовое семейство
+    mov     edi, eax
+    shr     edi, 4
+    and     edi, 0xF                    ; базовая модель
+    cmp     esi, 6
+    je      .ext_model
+    cmp     esi, 0xF
+    jne     .signature_ready
+    mov     edx, eax
+    shr     edx, 20
+    and     edx, 0xFF
+    add     esi, edx                    ; семейство = 0xF + расширенное
+.ext_model:
+    mov     edx, eax
+    shr     edx, 12
+    and     edx, 0xF0
+    or      edi, edx                    ; модель |= расширенная << 4
+.signature_ready:
+
+    xor     r10d, r10d                  ; BMI2
+    cmp     r8d, 7
+    jb      .features_ready
+    mov     eax, 7
+    xor     ecx, ecx
+    cpuid
+    bt      ebx, 8
+    setc    r10b
+    bt      ebx, 5                      ; AVX2
+    jnc     .features_ready
+    and     r11d, CPUID1_ECX_OSXSAVE_AVX
+    cmp     r11d, CPUID1_ECX_OSXSAVE_AVX
+    jne     .features_ready
+    xor     ecx, ecx
+    xgetbv
+    and     eax, XCR0_SSE_AVX
+    cmp     eax, XCR0_SSE_AVX
+    jne     .features_ready
+    lea     rax, [rel bignum_div_u64_shift_avx2]
+    mov     [rel dispatch_table + KERNEL_SHIFT * 8], rax
+.features_ready:
+    mov     [rel dispatch_bmi2], r10
+
+    ; Быстрый div r64?
+    cmp     r9d, VENDOR_INTEL
+    jne     .not_intel
+    cmp     esi, 6
+    ja      .pick_hwdiv                 ; семейства новее 6
+    jb      .pick_reciprocal
+    lea     rax, [rel fast_div_models]
+    bt      dword [rax], edi
+    jc      .pick_hwdiv
+    jmp     .pick_reciprocal
+.not_intel:
+    cmp     r9d, VENDOR_AMD
+    jne     .pick_reciprocal
+    cmp     esi, AMD_ZEN3_FAMILY
+    jae     .pick_hwdiv
+
+.pick_reciprocal:
+    mov     eax, KERNEL_PREINV
+    test    r10, r10
+    jz      .exit
+    mov     eax, KERNEL_MULX
+    jmp     .exit
+.pick_hwdiv:
+    mov     eax, KERNEL_HWDIV
+.exit:
+    pop     rbx
+    ret
+
+; =============================================================================
+; @brief  Выбирает ядро, если оно ещё не выбрано.
+;
+; @details
+;   Ядро запоминается в dispatch_base, указатель вызова ведёт на
+;   маршрутизатор dispatch_routed.
+;
+; @clobbers rax, rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+dispatch_init:
+    cmp     qword [rel dispatch_kernel], 0
+    jge     .done
+    call    dispatch_detect
+    lea     rcx, [rel dispatch_table]
+    mov     rcx, [rcx + rax * 8]
+    mov     [rel dispatch_base], rcx
+    lea     rcx, [rel dispatch_routed]
+    mov     [rel dispatch_impl], rcx
+    mov     [rel dispatch_kernel], rax
+.done:
+    ret
+
+; =============================================================================
+; @brief  Заглушка первого вызова: выбирает ядро и передаёт ему аргументы.
+; =============================================================================
+align 16
+dispatch_lazy:
+    push    rdi
+    push    rsi
+    push    rdx
+    push    rcx
+    sub     rsp, 8
+    call    dispatch_init
+    add     rsp, 8
+    pop     rcx
+    pop     rdx
+    pop     rsi
+    pop     rdi
+    jmp     [rel dispatch_impl]
+
+; =============================================================================
+; @brief  Переход в ядро shift (вариант выбран dispatch_detect).
+; =============================================================================
+align 16
+dispatch_shift:
+    jmp     [rel dispatch_table + KERNEL_SHIFT * 8]
+
+; =============================================================================
+; @brief  Маршрутизация степеней двойки в ядро shift и малых делителей в
+;         ядро small.
+;
+; @details
+;   При n == NULL или неверной длине вызов уходит в ядро по умолчанию (или
+;   в shift): ядро само вернёт код ошибки.
+; =============================================================================
+align 16
+dispatch_routed:
+    lea     rax, [rdx - 1]
+    test    rax, rdx
+    jz      dispatch_shift              ; d = 2^k или d = 0
+%if SMALL_MIN_LEN <= BIGNUM_CAPACITY
+    mov     rax, rdx
+    shr     rax, 32
+    jnz     .base                       ; d >= 2^32
+    test    rsi, rsi
+    jz      .base
+    cmp     dword [rsi + BIGNUM_LEN_OFFSET], SMALL_MIN_LEN
+    jl      .base
+    jmp     bignum_div_u64_small        ; d >= 3: d < 2 — степени двойки
+.base:
+%endif
+    jmp     [rel dispatch_base]
+
+; =============================================================================
+; @brief  Номер корзины автонастройки по длине и делителю.
+;
+; @param  %1  [in]  длина (32-битный регистр, беззнаковое сравнение)
+; @param  %2  [in]  делитель (64-битный регистр)
+; @param  %3  [out] номер корзины (64-битный регистр)
+; @clobbers rax, flags
+; =============================================================================
+%macro TUNE_BUCKET 3
+    xor     %3, %3
+    cmp     %1, TUNE_LEN_SMALL
+    jbe     %%len_done
+    inc     %3
+    cmp     %1, TUNE_LEN_MEDIUM
+    jbe     %%len_done
+    inc     %3
+%%len_done:
+    mov     rax, %2
+    shr     rax, 32
+    jz      %%done
+    add     %3, TUNE_LEN_CLASSES
+%%done:
+%endmacro
+
+; =============================================================================
+; @brief  Маршрутизация по таблице автонастройки.
+;
+; @details
+;   При n == NULL или неверной длине выбирается любая корзина: ядро само
+;   вернёт код ошибки.
+; =============================================================================
+align 16
+dispatch_tuned:
+    lea     rax, [rdx - 1]
+    test    rax, rdx
+    jz      dispatch_shift              ; d = 2^k или d = 0
+    xor     r8d, r8d
+    test    rsi, rsi
+    jz      .route
+    mov     r9d, [rsi + BIGNUM_LEN_OFFSET]
+    TUNE_BUCKET r9d, rdx, r8
+.route:
+    lea     rax, [rel tuned_ptrs]
+    jmp     [rax + r8 * 8]
+
+; =============================================================================
+; @brief      Выполняет деление большого числа на uint64_t выбранным ядром.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: bignum_t *q        (Указатель на структуру для частного)
+;   - `rsi`: const bignum_t *n  (Указатель на структуру делимого)
+;   - `rdx`: uint64_t d         (64-битный делитель)
+;   - `rcx`: uint64_t *rem      (Указатель на 64-битный остаток)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64
+
+bignum_div_u64:
+    jmp     [rel dispatch_impl]
+
+; =============================================================================
+; @brief      Деление с готовым контекстом делителя (внутренняя функция
+;             bignum_div_u64_pow10).
+;
+; @details    Ядру hwdiv обратная величина не нужна, и ему передаётся
+;             ctx->d: на CPU с быстрым делителем результат и время те же,
+;             что у bignum_div_u64. При любом другом выбранном ядре вызов
+;             уходит в bignum_div_u64_pre без подготовки делителя.
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: bignum_t *q, rsi: const bignum_t *n,
+;             rdx: const bignum_div_u64_ctx_t *ctx, rcx: uint64_t *rem
+; @return     rax: bignum_div_u64_status_t (0, -1, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_ctx_dispatch
+
+bignum_div_u64_ctx_dispatch:
+    mov     rax, [rel dispatch_kernel]
+    test    rax, rax
+    js      .init                       ; ядро ещё не выбрано
+    jnz     bignum_div_u64_pre
+    mov     rdx, [rdx + CTX_D_OFFSET]   ; KERNEL_HWDIV
+    jmp     bignum_div_u64_hwdiv
+.init:
+    push    rdi
+    push    rsi
+    push    rdx
+    push    rcx
+    sub     rsp, 8
+    call    dispatch_init
+    add     rsp, 8
+    pop     rcx
+    pop     rdx
+    pop     rsi
+    pop     rdi
+    jmp     bignum_div_u64_ctx_dispatch
+
+; =============================================================================
+; @brief      Возвращает номер выбранного ядра (выбирает его при необходимости).
+;
+; @abi        System V AMD64 ABI
+; @return     eax: bignum_div_u64_kernel_t
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_get_kernel
+
+bignum_div_u64_get_kernel:
+    sub     rsp, 8
+    call    dispatch_init
+    add     rsp, 8
+    mov     rax, [rel dispatch_kernel]
+    ret
+
+; =============================================================================
+; @brief      Устанавливает ядро для bignum_div_u64.
+;
+; @details    Ядро используется для всех делителей и длин: маршрутизация
+;             малых делителей и таблица автонастройки отключаются.
+;
+; @abi        System V AMD64 ABI
+; @param[in]  edi: bignum_div_u64_kernel_t kernel
+; @return     rax: bignum_div_u64_status_t (0, -5)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_set_kernel
+
+bignum_div_u64_set_kernel:
+    mov     edi, edi
+    cmp     rdi, KERNEL_COUNT
+    jae     .err_unsupported
+    push    rdi
+    call    dispatch_init               ; заполняет dispatch_bmi2
+    pop     rdi
+    cmp     rdi, KERNEL_MULX
+    jne     .install
+    cmp     qword [rel dispatch_bmi2], 0
+    je      .err_unsupported
+.install:
+    lea     rcx, [rel dispatch_table]
+    mov     rcx, [rcx + rdi * 8]
+    mov     [rel dispatch_impl], rcx
+    mov     [rel dispatch_kernel], rdi
+    mov     eax, BIGNUM_DIV_U64_OK
+    ret
+.err_unsupported:
+    mov     eax, BIGNUM_DIV_U64_ERR_UNSUPPORTED
+    ret
+
+; =============================================================================
+; @brief      Устанавливает таблицу ядер по корзинам (внутренняя функция
+;             bignum_div_u64_autotune).
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: const uint8_t ids[TUNE_BUCKETS] (номера ядер по корзинам)
+; @return     rax: bignum_div_u64_status_t (0, -5 — неверный или
+;             неподдерживаемый номер; таблица тогда не меняется)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_install_tuned
+
+bignum_div_u64_install_tuned:
+    push    rdi
+    call    dispatch_init               ; заполняет dispatch_bmi2
+    pop     rdi
+
+    xor     ecx, ecx
+.validate_loop:
+    movzx   eax, byte [rdi + rcx]
+    cmp     eax, KERNEL_COUNT
+    jae     .err_unsupported
+    cmp     eax, KERNEL_MULX
+    jne     .validate_next
+    cmp     qword [rel dispatch_bmi2], 0
+    je      .err_unsupported
+.validate_next:
+    inc     ecx
+    cmp     ecx, TUNE_BUCKETS
+    jb      .validate_loop
+
+    lea     rsi, [rel dispatch_table]
+    lea     rdx, [rel tuned_ptrs]
+    lea     r8, [rel tuned_ids]
+    xor     ecx, ecx
+.install_loop:
+    movzx   eax, byte [rdi + rcx]
+    mov     [r8 + rcx * 8], rax
+    mov     rax, [rsi + rax * 8]
+    mov     [rdx + rcx * 8], rax
+    inc     ecx
+    cmp     ecx, TUNE_BUCKETS
+    jb      .install_loop
+
+    lea     rax, [rel dispatch_tuned]
+    mov     [rel dispatch_impl], rax
+    mov     qword [rel dispatch_kernel], KERNEL_AUTOTUNED
+    mov     eax, BIGNUM_DIV_U64_OK
+    ret
+.err_unsupported:
+    mov     eax, BIGNUM_DIV_U64_ERR_UNSUPPORTED
+    ret
+
+; =============================================================================
+; @brief      Возвращает ядро, которое выполнит деление n->len = len на d.
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: size_t len
+; @param[in]  rsi: uint64_t d
+; @return     eax: bignum_div_u64_kernel_t
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_kernel_for
+
+bignum_div_u64_kernel_for:
+    push    rdi
+    push    rsi
+    sub     rsp, 8
+    call    dispatch_init
+    add     rsp, 8
+    pop     rsi
+    pop     rdi
+    mov     rcx, [rel dispatch_kernel]
+    cmp     rcx, KERNEL_AUTOTUNED
+    je      .power_of_two
+    lea     rax, [rel dispatch_routed]
+    cmp     [rel dispatch_impl], rax
+    jne     .done                       ; ядро закреплено
+.power_of_two:
+    lea     rax, [rsi - 1]
+    test    rax, rsi
+    jnz     .not_shift
+    mov     ecx, KERNEL_SHIFT
+    jmp     .done
+.not_shift:
+    cmp     rcx, KERNEL_AUTOTUNED
+    jne     .small
+    mov     edx, BIGNUM_CAPACITY + 1
+    cmp     rdi, rdx
+    cmova   rdi, rdx                    ; длины > 2^32 — в старший класс
+    TUNE_BUCKET edi, rsi, r8
+    lea     rcx, [rel tuned_ids]
+    mov     rcx, [rcx + r8 * 8]
+    jmp     .done
+.small:
+%if SMALL_MIN_LEN <= BIGNUM_CAPACITY
+    mov     rax, rsi
+    shr     rax, 32
+    jnz     .done                       ; d >= 2^32
+    cmp     rdi, SMALL_MIN_LEN
+    jb      .done
+    mov     ecx, KERNEL_SMALL
+%endif
+.done:
+    mov     rax, rcx
+    ret
+
+; =============================================================================
+; @brief      Возвращает имя ядра ("hwdiv", "preinv", "mulx", "half",
+;             "small", "shift", "autotuned").
+;
+; @abi        System V AMD64 ABI
+; @param[in]  edi: bignum_div_u64_kernel_t kernel
+; @return     rax: const char * ("unknown" для неверного номера)
+; =============================================================================
+align 16
+global bignum_div_u64_kernel_name
+
+bignum_div_u64_kernel_name:
+    mov     edi, edi
+    lea     rax, [rel kernel_name_tuned]
+    cmp     rdi, KERNEL_AUTOTUNED
+    je      .done
+    lea     rax, [rel kernel_name_none]
+    cmp     rdi, KERNEL_COUNT
+    jae     .done
+    lea     rax, [rel kernel_names]
+    lea     rax, [rax + rdi * KERNEL_NAME_LEN]
+.done:
+    ret
@@ -0,0 +1,173 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_ex.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Деление большого числа на uint64_t с флагами выходного контракта.
+;
+; @details
+;   Реализует функцию bignum_div_u64_ex на ассемблере x86-64 (синтаксис
+;   YASM) в соответствии с System V AMD64 ABI. Флаги позволяют вызывающему
+;   коду отказаться от частей контракта bignum_div_u64, за которые он не
+;   хочет платить: обнуления хвоста q, записи остатка и поиска старшего
+;   ненулевого слова частного. Деление выполняется циклом `div r64`.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+section .text
+
+; =============================================================================
+; @brief      Делит n на d с учётом флагов bignum_div_u64_flags_t.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: bignum_t *q             (Указатель на структуру для частного)
+;   - `rsi`: const bignum_t *n       (Указатель на структуру делимого)
+;   - `rdx`: uint64_t d              (64-битный делитель)
+;   - `rcx`: uint64_t *rem           (Указатель на остаток; NULL при REM_OPTIONAL)
+;   - `r8`:  unsigned flags          (Комбинация DIV_FLAG_*)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** неизвестные биты флагов, затем проверки bignum_div_u64
+;       (rem == NULL допускается при DIV_FLAG_REM_OPTIONAL).
+;   2.  **Деление:** цикл `div r64` от старшего слова к младшему; q == n
+;       допускается.
+;   3.  **Остаток:** записывается, если rem != NULL.
+;   4.  **Длина:** без DIV_FLAG_NO_NORMALIZE — поиск старшего ненулевого
+;       слова частного, иначе q->len = n->len.
+;   5.  **Хвост:** без DIV_FLAG_NO_TAIL_CLEAR обнуляются
+;       q->words[q->len..BIGNUM_CAPACITY-1].
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4, -5)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_ex
+
+bignum_div_u64_ex:
+    ; --- Пролог ---
+    push    rbx
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+
+    mov     r12, rdi    ; q
+    mov     r13, rsi    ; n
+    mov     r14, rdx    ; d
+    mov     r15, rcx    ; rem
+    mov     ebx, r8d    ; flags
+
+    ; 1. Валидация входных данных
+    test    ebx, ~DIV_FLAGS_ALL
+    jnz     .err_unsupported
+    test    r12, r12
+    jz      .err_null_ptr
+    test    r13, r13
+    jz      .err_null_ptr
+    test    r15, r15
+    jnz     .rem_ok
+    test    ebx, DIV_FLAG_REM_OPTIONAL
+    jz      .err_null_ptr
+.rem_ok:
+
+    mov     r9d, [r13 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    test    r14, r14
+    jz      .err_div_by_zero
+
+    cmp     r12, r13
+    je      .no_overlap
+    lea     rax, [r13 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r12, rax
+    jae     .no_overlap
+    lea     rax, [r12 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r13, rax
+    jb      .err_buffer_overlap
+.no_overlap:
+
+    ; 2. Цикл деления
+    mov     r11, r9                     ; n->len
+    xor     edx, edx
+    test    r9, r9
+    jz      .quotient_done
+.main_loop:
+    dec     r9
+    mov     rax, [r13 + r9 * 8]
+    div     r14
+    mov     [r12 + r9 * 8], rax
+    test    r9, r9
+    jnz     .main_loop
+.quotient_done:
+
+    ; 3. Остаток
+    test    r15, r15
+    jz      .rem_done
+    mov     [r15], rdx
+.rem_done:
+
+    ; 4. Длина частного
+    test    ebx, DIV_FLAG_NO_NORMALIZE
+    jnz     .set_len
+.find_len:
+    test    r11, r11
+    jz      .set_len
+    cmp     qword [r12 + r11 * 8 - 8], 0
+    jne     .set_len
+    dec     r11
+    jmp     .find_len
+.set_len:
+    mov     [r12 + BIGNUM_LEN_OFFSET], r11d
+
+    ; 5. Хвост частного
+    test    ebx, DIV_FLAG_NO_TAIL_CLEAR
+    jnz     .done
+    mov     ecx, BIGNUM_CAPACITY
+    sub     ecx, r11d
+    jz      .done
+    lea     rdi, [r12 + r11 * 8]
+    xor     eax, eax
+    rep     stosq
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_unsupported:
+    mov     eax, BIGNUM_DIV_U64_ERR_UNSUPPORTED
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.err_buffer_overlap:
+    mov     eax, BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP
+
+.exit:
+    ; --- Эпилог ---
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbx
+    ret
@@ -0,0 +1,468 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_kernels.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Альтернативные ядра деления большого числа на uint64_t.
+;
+; @details
+;   Реализует ядра bignum_div_u64_preinv, bignum_div_u64_mulx,
+;   bignum_div_u64_half, bignum_div_u64_small (с вариантом
+;   bignum_div_u64_small_pre) и bignum_div_u64_shift
+;   (с вариантом bignum_div_u64_shift_avx2) на ассемблере x86-64 (синтаксис YASM) в соответствии
+;   с System V AMD64 ABI. Сигнатура, проверки и коды состояния у всех ядер
+;   совпадают с bignum_div_u64; ядро для публичного символа выбирается во
+;   время выполнения (bignum_div_u64_dispatch.asm).
+;
+;   - preinv: обратная величина (один `div` на вызов) и шаги `mul`/`imul`.
+;     Выгодно там, где `div r64` медленный (Skylake, Zen 1/2).
+;   - mulx:   то же с BMI2 `mulx`.
+;   - half:   при d < 2^32 каждое слово делится двумя `div r32`, которые
+;             заметно быстрее `div r64` на старых ядрах; при d >= 2^32
+;             управление передаётся ядру preinv.
+;   - small:  при 2 <= d < 2^32 остатки считаются цепочкой по два слова
+;             r' = (r * (2^128 mod d) + K) mod d с приведением умножением на
+;             floor(2^64 / d), а слова частного — точным делением разности
+;             на нечётную часть d (умножение на обратную по модулю 2^64).
+;             Цепочка вдвое короче, чем у preinv, и не содержит `div`;
+;             предел — пропускная способность умножителя. При прочих d
+;             управление передаётся ядру preinv. Вариант small_pre берёт
+;             константы из готовой таблицы (bignum_div_u64_tables.asm)
+;             вместо `div` и обращения d' на входе.
+;   - shift:  при d = 2^k частное — сдвиг делимого вправо на k бит,
+;             остаток — n->words[0] & (d - 1); `div` не выполняется.
+;             Вариант avx2 сдвигает по четыре слова за итерацию. При прочих
+;             d управление передаётся ядру preinv.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+;   - rev. 2 (15.10.2026): Ядро bignum_div_u64_small.
+;   - rev. 3 (15.10.2026): Ядра bignum_div_u64_shift и bignum_div_u64_shift_avx2.
+;   - rev. 4 (16.10.2026): Ядро bignum_div_u64_small_pre с константами из
+;                          таблицы; SMALL_REDUCE перенесён в bignum_div_u64.inc.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+%define KIND_PREINV 0
+%define KIND_MULX   1
+%define KIND_HALF   2
+%define KIND_SMALL  3
+%define KIND_SHIFT  4
+%define KIND_SHIFT_AVX2 5
+%define KIND_SMALL_PRE  6
+
+; =============================================================================
+; @brief  Слово частного точным делением на нечётную часть d (ядро small).
+;
+; @details
+;   Если r — остаток до слова, r' — после, то r * 2^64 + n - r' = q * d.
+;   Сдвиг 128-битной разности на s = ctz(d) и умножение на inv = d'^-1
+;   mod 2^64 дают q без деления; остатки в цепочку не возвращаются.
+;
+; @param  %1  [in] слово делимого n (регистр, портится)
+; @param  %2  [in] остаток после слова r'
+; @param  %3  [in] остаток до слова r (регистр, портится)
+; @param  %4  смещение слова относительно r12 + r9 * 8
+; @param  cl  s, [rsp + 8] — inv
+; @clobbers flags
+; =============================================================================
+%macro SMALL_QUOTIENT_WORD 4
+    sub     %1, %2
+    sbb     %3, 0
+    shrd    %1, %3, cl
+    imul    %1, [rsp + 8]
+    mov     [r12 + r9 * 8 + %4], %1
+%endmacro
+
+; =============================================================================
+; @brief  Цепочка остатков ядра small, запись частного и его нормализация.
+;
+; @param  r12  [in] q, r13 [in] n, r9 [in] n->len (>= 1)
+; @param  r14  [in] d, rbx [in] m, rbp [in] c1, cl [in] s
+; @param  стек [in] [rsp] = c2, [rsp + 8] = inv, [rsp + 16] = rem,
+;              [rsp + 24] = сохранённый rbp; снимаются макросом
+; @clobbers rax, rdx, rsi, rdi, r8–r11, r15, flags
+; =============================================================================
+%macro SMALL_DIV_CHAIN 0
+    ; 4. Цепочка остатков по два слова: r' = (r * c2 + K) mod d
+    xor     r8d, r8d                    ; r
+    test    r9d, 1
+    jz      %%pair_check
+    dec     r9
+    mov     rsi, [r13 + r9 * 8]
+    mov     r10, rsi
+    SMALL_REDUCE r10                    ; r1 = n mod d
+    SMALL_QUOTIENT_WORD rsi, r10, r8, 0
+    mov     r8, r10
+    jmp     %%pair_check
+%%pair_loop:
+    mov     rsi, [r13 + r9 * 8 - 8]     ; n[i]
+    mov     rdi, [r13 + r9 * 8 - 16]    ; n[i-1]
+    mov     r10, rsi
+    SMALL_REDUCE r10                    ; a = n[i] mod d
+    mov     r11, rdi
+    SMALL_REDUCE r11                    ; b = n[i-1] mod d
+    mov     rax, r10
+    imul    rax, rbp
+    add     r11, rax
+    SMALL_REDUCE r11                    ; K = (a * c1 + b) mod d
+    mov     r15, r8
+    imul    r15, rbp
+    add     r15, r10
+    SMALL_REDUCE r15                    ; r1 = (r * c1 + a) mod d
+    mov     r10, r8
+    imul    r10, [rsp]
+    add     r11, r10
+    SMALL_REDUCE r11                    ; r0 = (r * c2 + K) mod d
+    sub     r9, 2
+    SMALL_QUOTIENT_WORD rsi, r15, r8, 8
+    SMALL_QUOTIENT_WORD rdi, r11, r15, 0
+    mov     r8, r11
+%%pair_check:
+    cmp     r9, 2
+    jae     %%pair_loop
+
+    add     rsp, 16
+    pop     r15
+    pop     rbp
+    mov     [r15], r8
+    mov     r11d, [r13 + BIGNUM_LEN_OFFSET]
+    FINISH_QUOTIENT r12, r11
+%endmacro
+
+; =============================================================================
+; @brief  Тело ядра: пролог, валидация, деление и эпилог.
+;
+; @details
+;   Порядок проверок совпадает с bignum_div_u64: NULL, длина, ноль,
+;   частичное перекрытие (q == n допускается).
+;
+; @param  %1  KIND_PREINV, KIND_MULX, KIND_HALF (d < 2^32), KIND_SMALL
+;             (2 <= d < 2^32), KIND_SMALL_PRE (rdx — константы small вместо
+;             d), KIND_SHIFT или KIND_SHIFT_AVX2 (d = 2^k)
+; =============================================================================
+%macro DIV_U64_KERNEL 1
+    ; --- Пролог ---
+    push    rbx
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+
+    mov     r12, rdi    ; q
+    mov     r13, rsi    ; n
+    mov     r14, rdx    ; d
+    mov     r15, rcx    ; rem
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      %%err_null_ptr
+    test    r13, r13
+    jz      %%err_null_ptr
+    test    r15, r15
+    jz      %%err_null_ptr
+
+    mov     r9d, [r13 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      %%err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      %%err_bad_length
+
+    test    r14, r14
+    jz      %%err_div_by_zero
+
+    cmp     r12, r13
+    je      %%no_overlap
+    lea     rax, [r13 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r12, rax
+    jge     %%no_overlap
+    lea     rax, [r12 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r13, rax
+    jl      %%err_buffer_overlap
+%%no_overlap:
+
+    ; 2. Тривиальный случай n->len == 0
+    mov     qword [r15], 0
+    test    r9, r9
+    jnz     %%main_logic
+    xor     eax, eax
+    mov     ecx, BIGNUM_T_SIZE_ALIGNED / 8
+    mov     rdi, r12
+    rep     stosq
+    jmp     %%done
+
+%%main_logic:
+    mov     r11, r9                     ; n->len для нормализации частного
+%if %1 == KIND_HALF
+    ; 3. Две ступени div r32 на слово
+    xor     r8d, r8d
+%%half_loop:
+    dec     r9
+    mov     rsi, [r13 + r9 * 8]
+    mov     rax, rsi
+    shr     rax, 32
+    mov     edx, r8d
+    div     r14d                        ; eax = старшая половина частного
+    mov     r10d, eax
+    mov     eax, esi
+    div     r14d                        ; eax = младшая половина, edx = остаток
+    shl     r10, 32
+    or      r10, rax
+    mov     [r12 + r9 * 8], r10
+    mov     r8d, edx
+    test    r9, r9
+    jnz     %%half_loop
+    mov     [r15], r8
+    FINISH_QUOTIENT r12, r11
+%elif %1 == KIND_SMALL_PRE
+    ; 3. Готовые константы small (раскладка SCTX_*)
+    push    rbp
+    push    r15                         ; rem
+    mov     rcx, [r14 + SCTX_SHIFT_OFFSET]
+    mov     rbx, [r14 + SCTX_M_OFFSET]
+    mov     rbp, [r14 + SCTX_C1_OFFSET]
+    push    qword [r14 + SCTX_INV_OFFSET]
+    push    qword [r14 + SCTX_C2_OFFSET]
+    mov     r14, [r14 + SCTX_D_OFFSET]
+    SMALL_DIV_CHAIN
+%elif %1 == KIND_SMALL
+    ; 3. Константы: inv = d'^-1 mod 2^64 для нечётной части d = d' * 2^s,
+    ;    m = floor(2^64 / d), c1 = 2^64 mod d, c2 = 2^128 mod d
+    push    rbp
+    push    r15                         ; rem
+    bsf     rcx, r14                    ; cl = s
+    mov     rsi, r14
+    shr     rsi, cl                     ; d'
+    lea     r10, [rsi + rsi * 2]
+    xor     r10, 2                      ; x: верны 5 младших бит
+    mov     r11, rsi
+    imul    r11, r10
+    neg     r11
+    inc     r11                         ; y = 1 - d' * x
+%rep 4
+    lea     rdi, [r11 + 1]
+    imul    r10, rdi                    ; x *= 1 + y: точность удваивается
+    imul    r11, r11                    ; y = y^2 (независимо от x)
+%endrep
+    mov     edx, 1
+    xor     eax, eax
+    div     r14                         ; rax = m, rdx = c1
+    mov     rbx, rax
+    mov     rbp, rdx
+    imul    rdx, rdx
+    mov     r11, rdx
+    SMALL_REDUCE r11                    ; r11 = c2
+    push    r10                         ; [rsp + 8] = inv
+    push    r11                         ; [rsp] = c2
+
+    SMALL_DIV_CHAIN
+%elif %1 == KIND_SHIFT || %1 == KIND_SHIFT_AVX2
+    ; 3. q[i] = (n[i] >> k) | (n[i+1] << (64 - k)) по возрастанию i: слово
+    ;    n[i+1] читается до записи q[i], поэтому допускается q == n
+    bsf     rcx, r14                    ; cl = k
+    lea     rax, [r14 - 1]
+    and     rax, [r13]
+    mov     [r15], rax                  ; rem = n[0] & (d - 1)
+    xor     r10d, r10d                  ; i
+    dec     r9                          ; индекс старшего слова
+%if %1 == KIND_SHIFT_AVX2
+    cmp     r9, 4
+    jb      %%tail_check
+    vmovq   xmm0, rcx
+    mov     eax, 64
+    sub     eax, ecx
+    vmovq   xmm1, rax                   ; 64 - k; сдвиг на 64 даёт 0
+    lea     r8, [r9 - 4]
+%%vector_loop:
+    vmovdqu ymm2, [r13 + r10 * 8]
+    vmovdqu ymm3, [r13 + r10 * 8 + 8]
+    vpsrlq  ymm2, ymm2, xmm0
+    vpsllq  ymm3, ymm3, xmm1
+    vpor    ymm2, ymm2, ymm3
+    vmovdqu [r12 + r10 * 8], ymm2
+    add     r10, 4
+    cmp     r10, r8
+    jbe     %%vector_loop
+%endif
+    jmp     %%tail_check
+%%tail_loop:
+    mov     rax, [r13 + r10 * 8]
+    mov     rdx, [r13 + r10 * 8 + 8]
+    shrd    rax, rdx, cl
+    mov     [r12 + r10 * 8], rax
+    inc     r10
+%%tail_check:
+    cmp     r10, r9
+    jb      %%tail_loop
+    mov     rax, [r13 + r9 * 8]
+    shr     rax, cl
+    mov     [r12 + r9 * 8], rax
+%if %1 == KIND_SHIFT_AVX2
+    vzeroupper
+%endif
+    FINISH_QUOTIENT r12, r11
+%else
+    ; 3. Обратная величина и цикл шагов DIV_2BY1_PREINV(_MULX)
+    PREINV_SETUP r14, rbx               ; r14 = dnorm, rbx = v, rcx = shift
+    PREINV_DIV_LOOP %1
+%endif
+
+%%done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     %%exit
+
+%%err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     %%exit
+
+%%err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     %%exit
+
+%%err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     %%exit
+
+%%err_buffer_overlap:
+    mov     eax, BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP
+    jmp     %%exit
+
+%%exit:
+    ; --- Эпилог ---
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbx
+    ret
+%endmacro
+
+section .text
+
+; =============================================================================
+; @brief      Ядро деления с обратной величиной (`mul`).
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: bignum_t *q, rsi: const bignum_t *n, rdx: uint64_t d,
+;             rcx: uint64_t *rem (как у bignum_div_u64)
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_preinv
+
+bignum_div_u64_preinv:
+    DIV_U64_KERNEL KIND_PREINV
+
+; =============================================================================
+; @brief      Ядро деления с обратной величиной (BMI2 `mulx`).
+;
+; @details    Вызывается только при наличии BMI2 (CPUID.7.0:EBX[8]).
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_mulx
+
+bignum_div_u64_mulx:
+    DIV_U64_KERNEL KIND_MULX
+
+; =============================================================================
+; @brief      Ядро деления по 32-битным полусловам (`div r32`).
+;
+; @details    При d >= 2^32 аргументы без изменений передаются ядру preinv.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_half
+
+bignum_div_u64_half:
+    mov     rax, rdx
+    shr     rax, 32
+    jnz     bignum_div_u64_preinv
+    DIV_U64_KERNEL KIND_HALF
+
+; =============================================================================
+; @brief      Ядро для делителей 2 <= d < 2^32: цепочка остатков по два слова.
+;
+; @details    При d < 2 или d >= 2^32 аргументы без изменений передаются
+;             ядру preinv.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_small
+
+bignum_div_u64_small:
+    cmp     rdx, 2
+    jb      bignum_div_u64_preinv
+    mov     rax, rdx
+    shr     rax, 32
+    jnz     bignum_div_u64_preinv
+    DIV_U64_KERNEL KIND_SMALL
+
+; =============================================================================
+; @brief      Ядро small с предвычисленными константами делителя.
+;
+; @details    Вместо d в rdx передаётся указатель на константы (раскладка
+;             SCTX_*, 2 <= d < 2^32). Вызывается bignum_div_u64_pow10
+;             при n->len >= SMALL_MIN_LEN.
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: bignum_t *q, rsi: const bignum_t *n, rdx: константы small,
+;             rcx: uint64_t *rem
+; @return     rax: bignum_div_u64_status_t (0, -1, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_small_pre
+
+bignum_div_u64_small_pre:
+    DIV_U64_KERNEL KIND_SMALL_PRE
+
+; =============================================================================
+; @brief      Ядро для делителей-степеней двойки: сдвиг вместо деления.
+;
+; @details    При d, не являющемся степенью двойки (и не равном 0),
+;             аргументы без изменений передаются ядру preinv.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_shift
+
+bignum_div_u64_shift:
+    lea     rax, [rdx - 1]
+    test    rax, rdx
+    jnz     bignum_div_u64_preinv
+    DIV_U64_KERNEL KIND_SHIFT
+
+; =============================================================================
+; @brief      Вариант bignum_div_u64_shift со сдвигом AVX2 по четыре слова.
+;
+; @details    Вызывается только при наличии AVX2 и поддержке регистров ymm
+;             операционной системой (bignum_div_u64_dispatch.asm).
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11, ymm0–ymm3
+; =============================================================================
+align 16
+global bignum_div_u64_shift_avx2
+
+bignum_div_u64_shift_avx2:
+    lea     rax, [rdx - 1]
+    test    rax, rdx
+    jnz     bignum_div_u64_preinv
+    DIV_U64_KERNEL KIND_SHIFT_AVX2
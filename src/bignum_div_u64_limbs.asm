@@ -0,0 +1,121 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_limbs.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Деление массива слов произвольной длины на uint64_t.
+;
+; @details
+;   Реализует функцию bignum_div_u64_limbs на ассемблере x86-64 (синтаксис
+;   YASM) в соответствии с System V AMD64 ABI. В отличие от bignum_div_u64
+;   функция не привязана к раскладке bignum_t: делимое и частное — буферы
+;   вызывающего кода из `len` слов (младшее слово первым), поле длины не
+;   пишется, хвост не обнуляется. Цикл — PREINV_DIV_CORE, общий с ядрами
+;   preinv/mulx.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+section .text
+
+; =============================================================================
+; @brief      Делит n[0..len-1] на d: q[0..len-1] = n / d, *rem = n % d.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: uint64_t *q             (Указатель на частное, len слов)
+;   - `rsi`: const uint64_t *n       (Указатель на делимое, len слов)
+;   - `rdx`: size_t len              (Число слов)
+;   - `rcx`: uint64_t d              (Делитель)
+;   - `r8`:  uint64_t *rem           (Указатель на остаток)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** NULL (q и n при len == 0 не проверяются), d == 0,
+;       частичное перекрытие q и n (q == n допускается).
+;   2.  **len == 0:** *rem = 0, буферы не трогаются.
+;   3.  **Деление:** обратная величина нормализованного d и цикл
+;       PREINV_DIV_CORE. Пишутся ровно len слов частного, включая старшие
+;       нулевые.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_limbs
+
+bignum_div_u64_limbs:
+    ; --- Пролог ---
+    push    rbx
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+
+    mov     r12, rdi    ; q
+    mov     r13, rsi    ; n
+    mov     r9, rdx     ; len
+    mov     r14, rcx    ; d
+    mov     r15, r8     ; rem
+
+    ; 1. Валидация входных данных
+    test    r15, r15
+    jz      .err_null_ptr
+    test    r9, r9
+    jz      .empty
+    test    r12, r12
+    jz      .err_null_ptr
+    test    r13, r13
+    jz      .err_null_ptr
+
+    test    r14, r14
+    jz      .err_div_by_zero
+
+    cmp     r12, r13
+    je      .no_overlap
+    lea     rax, [r13 + r9 * 8]
+    cmp     r12, rax
+    jae     .no_overlap
+    lea     rax, [r12 + r9 * 8]
+    cmp     r13, rax
+    jb      .err_buffer_overlap
+.no_overlap:
+
+    ; 2. Обратная величина и цикл
+    PREINV_SETUP r14, rbx               ; r14 = dnorm, rbx = v, rcx = shift
+    PREINV_DIV_CORE 0
+    jmp     .done
+
+.empty:
+    test    r14, r14
+    jz      .err_div_by_zero
+    mov     qword [r15], 0
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.err_buffer_overlap:
+    mov     eax, BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP
+
+.exit:
+    ; --- Эпилог ---
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbx
+    ret
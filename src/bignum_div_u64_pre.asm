@@ -0,0 +1,191 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_pre.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Деление большого числа на uint64_t с предвычисленным контекстом делителя.
+;
+; @details
+;   Реализует функции bignum_div_u64_ctx_init и bignum_div_u64_pre на
+;   ассемблере x86-64 (синтаксис YASM) в соответствии с System V AMD64 ABI.
+;   Контекст содержит нормализующий сдвиг и обратную величину делителя
+;   (Möller–Granlund, "Improved division by invariant integers"), поэтому
+;   основной цикл обходится без инструкции `div`.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+;   - rev. 2 (15.10.2026): Деление на месте (q == n).
+;   - rev. 3 (15.10.2026): Цикл деления вынесен в макрос PREINV_DIV_LOOP.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+section .text
+
+; =============================================================================
+; @brief      Подготавливает контекст делителя.
+;
+; @details
+;   ### Алгоритм
+;   1.  `shift = clz(d)`, `dnorm = d << shift`.
+;   2.  `v = floor((2^128 - 1) / dnorm) - 2^64`, что равно частному от
+;       деления 128-битного числа (~dnorm : 2^64 - 1) на `dnorm`. Это
+;       единственный `div` за всё время жизни контекста.
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: bignum_div_u64_ctx_t *ctx (Указатель на контекст)
+; @param[in]  rsi: uint64_t d                (64-битный делитель)
+;
+; @return     rax: bignum_div_u64_status_t (0, -1, -2)
+; @clobbers   rcx, rdx
+; =============================================================================
+align 16
+global bignum_div_u64_ctx_init
+
+bignum_div_u64_ctx_init:
+    test    rdi, rdi
+    jz      .err_null_ptr
+    test    rsi, rsi
+    jz      .err_div_by_zero
+
+    mov     [rdi + CTX_D_OFFSET], rsi
+    PREINV_SETUP rsi, rax
+    mov     [rdi + CTX_DNORM_OFFSET], rsi
+    mov     [rdi + CTX_V_OFFSET], rax
+    mov     [rdi + CTX_SHIFT_OFFSET], rcx
+
+    mov     eax, BIGNUM_DIV_U64_OK
+    ret
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    ret
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    ret
+
+; =============================================================================
+; @brief      Выполняет деление большого числа на делитель из контекста.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: bignum_t *q                      (Указатель на структуру для частного)
+;   - `rsi`: const bignum_t *n                (Указатель на структуру делимого)
+;   - `rdx`: const bignum_div_u64_ctx_t *ctx  (Указатель на контекст делителя)
+;   - `rcx`: uint64_t *rem                    (Указатель на 64-битный остаток)
+;   - `rax`: bignum_div_u64_status_t          (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** как в bignum_div_u64; нулевой `ctx->d` (неинициализированный
+;       контекст) считается делением на ноль, `q == n` допускается.
+;   2.  **Нормализация "на лету":** делимое сдвигается влево на `shift` бит
+;       инструкцией `shld` по мере чтения слов; биты, вытесненные из старшего
+;       слова, образуют начальный остаток.
+;   3.  **Основной цикл:** от старшего слова к младшему выполняется шаг
+;       DIV_2BY1_PREINV (только `mul`/`imul`). Последний шаг вынесен из цикла,
+;       чтобы не читать слово ниже `n->words[0]`.
+;   4.  **Запись остатка:** `rem >> shift`.
+;   5.  **Нормализация частного:** `q->len` определяется сканированием
+;       от `n->len` вниз до первого ненулевого слова, затем обнуляется хвост `q`.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_pre
+
+bignum_div_u64_pre:
+    ; --- Пролог ---
+    push    rbx
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+
+    ; --- Сохранение аргументов ---
+    mov     r12, rdi    ; q
+    mov     r13, rsi    ; n
+    mov     r14, rdx    ; ctx
+    mov     r15, rcx    ; rem
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      .err_null_ptr
+    test    r13, r13
+    jz      .err_null_ptr
+    test    r14, r14
+    jz      .err_null_ptr
+    test    r15, r15
+    jz      .err_null_ptr
+
+    mov     r9d, [r13 + BIGNUM_LEN_OFFSET] ; r9d = n->len
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    cmp     qword [r14 + CTX_D_OFFSET], 0
+    je      .err_div_by_zero
+
+    ; Проверка перекрытия буферов (q == n допустимо: деление на месте)
+    cmp     r12, r13
+    je      .no_overlap
+    mov     rax, r12
+    lea     rcx, [r13 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     rax, rcx
+    jge     .no_overlap
+
+    mov     rax, r13
+    lea     rcx, [r12 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     rax, rcx
+    jge     .no_overlap
+    mov     eax, BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP
+    jmp     .exit
+.no_overlap:
+
+    ; 2. Инициализация rem и проверка тривиального случая
+    mov     qword [r15], 0
+    test    r9, r9
+    jnz     .main_logic
+
+    xor     rax, rax
+    mov     ecx, BIGNUM_T_SIZE_ALIGNED / 8
+    mov     rdi, r12
+    rep     stosq
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.main_logic:
+    mov     r11, r9                            ; r11 = n->len (для нормализации)
+    mov     rbx, [r14 + CTX_V_OFFSET]          ; v
+    mov     rcx, [r14 + CTX_SHIFT_OFFSET]      ; cl = shift
+    mov     r14, [r14 + CTX_DNORM_OFFSET]      ; dnorm
+
+    ; 3–5. Цикл деления, остаток, длина и хвост частного
+    PREINV_DIV_LOOP 0
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.exit:
+    ; --- Эпилог ---
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbx
+    ret
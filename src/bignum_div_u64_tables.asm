@@ -0,0 +1,503 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_div_u64_tables.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    16.10.2026
+;
+; @brief   Встроенные таблицы делителей: степени десяти и малые простые.
+;
+; @details
+;   Реализует функции bignum_div_u64_pow10 и bignum_mod_u64_small_prime на
+;   ассемблере x86-64 (синтаксис YASM) в соответствии с System V AMD64 ABI.
+;   Все константы делителей посчитаны заранее и лежат в .rodata, поэтому
+;   при вызове не выполняется ни `div`, ни обращение делителя, а вызывающему
+;   коду не нужно хранить контекст.
+;
+;   - bignum_div_u64_pow10: 10^1..10^9 при n->len >= SMALL_MIN_LEN делятся
+;     ядром small с готовыми константами (bignum_div_u64_small_pre), прочие
+;     случаи — через bignum_div_u64_ctx_dispatch с контекстом из
+;     bignum_div_u64_pow10_ctx: ядром hwdiv, если оно выбрано по умолчанию
+;     (ему подготовка не нужна), иначе bignum_div_u64_pre.
+;   - bignum_mod_u64_small_prime: остаток по первым SMALL_PRIMES простым
+;     цепочкой ядра small по два слова без записи частного.
+;
+;   Таблицы сгенерированы точной арифметикой: m = floor(2^64 / d),
+;   c1 = 2^64 mod d, c2 = 2^128 mod d, inv = (d >> s)^-1 mod 2^64,
+;   v = floor((2^128 - 1) / dnorm) - 2^64.
+;
+; @history
+;   - rev. 1 (16.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+extern bignum_div_u64_ctx_dispatch
+extern bignum_div_u64_small_pre
+
+section .rodata
+
+; 10^k, k = 0..POW10_MAX: d, dnorm, v, shift (bignum_div_u64_ctx_t)
+align 64
+global bignum_div_u64_pow10_ctx
+bignum_div_u64_pow10_ctx:
+    dq 0x0000000000000001, 0x8000000000000000, 0xFFFFFFFFFFFFFFFF, 63   ; 10^0
+    dq 0x000000000000000A, 0xA000000000000000, 0x9999999999999999, 60   ; 10^1
+    dq 0x0000000000000064, 0xC800000000000000, 0x47AE147AE147AE14, 57   ; 10^2
+    dq 0x00000000000003E8, 0xFA00000000000000, 0x0624DD2F1A9FBE76, 54   ; 10^3
+    dq 0x0000000000002710, 0x9C40000000000000, 0xA36E2EB1C432CA57, 50   ; 10^4
+    dq 0x00000000000186A0, 0xC350000000000000, 0x4F8B588E368F0846, 47   ; 10^5
+    dq 0x00000000000F4240, 0xF424000000000000, 0x0C6F7A0B5ED8D36B, 44   ; 10^6
+    dq 0x0000000000989680, 0x9896800000000000, 0xAD7F29ABCAF48578, 40   ; 10^7
+    dq 0x0000000005F5E100, 0xBEBC200000000000, 0x5798EE2308C39DF9, 37   ; 10^8
+    dq 0x000000003B9ACA00, 0xEE6B280000000000, 0x12E0BE826D694B2E, 34   ; 10^9
+    dq 0x00000002540BE400, 0x9502F90000000000, 0xB7CDFD9D7BDBAB7D, 30   ; 10^10
+    dq 0x000000174876E800, 0xBA43B74000000000, 0x5FD7FE17964955FD, 27   ; 10^11
+    dq 0x000000E8D4A51000, 0xE8D4A51000000000, 0x19799812DEA11197, 24   ; 10^12
+    dq 0x000009184E72A000, 0x9184E72A00000000, 0xC25C268497681C26, 20   ; 10^13
+    dq 0x00005AF3107A4000, 0xB5E620F480000000, 0x6849B86A12B9B01E, 17   ; 10^14
+    dq 0x00038D7EA4C68000, 0xE35FA931A0000000, 0x203AF9EE756159B2, 14   ; 10^15
+    dq 0x002386F26FC10000, 0x8E1BC9BF04000000, 0xCD2B297D889BC2B6, 10   ; 10^16
+    dq 0x016345785D8A0000, 0xB1A2BC2EC5000000, 0x70EF54646D496892,  7   ; 10^17
+    dq 0x0DE0B6B3A7640000, 0xDE0B6B3A76400000, 0x2725DD1D243ABA0E,  4   ; 10^18
+    dq 0x8AC7230489E80000, 0x8AC7230489E80000, 0xD83C94FB6D2AC34A,  0   ; 10^19
+
+; 10^k, k = 1..POW10_SMALL_MAX: d, m, c1, c2, inv, s (SCTX_*)
+align 64
+pow10_small:
+    dq 0x000000000000000A, 0x1999999999999999, 0x0000000000000006, 0x0000000000000006, 0xCCCCCCCCCCCCCCCD, 1   ; 10^1
+    dq 0x0000000000000064, 0x028F5C28F5C28F5C, 0x0000000000000010, 0x0000000000000038, 0x8F5C28F5C28F5C29, 2   ; 10^2
+    dq 0x00000000000003E8, 0x004189374BC6A7EF, 0x0000000000000268, 0x00000000000001C8, 0x1CAC083126E978D5, 3   ; 10^3
+    dq 0x0000000000002710, 0x00068DB8BAC710CB, 0x0000000000000650, 0x00000000000005B0, 0xD288CE703AFB7E91, 4   ; 10^4
+    dq 0x00000000000186A0, 0x0000A7C5AC471B47, 0x000000000000C9A0, 0x0000000000002CC0, 0x5D4E8FB00BCBE61D, 5   ; 10^5
+    dq 0x00000000000F4240, 0x000010C6F7A0B5ED, 0x0000000000086AC0, 0x0000000000033A00, 0x790FB65668C26139, 6   ; 10^6
+    dq 0x0000000000989680, 0x000001AD7F29ABCA, 0x000000000091BF00, 0x00000000007D4C00, 0xE5032477AE8D46A5, 7   ; 10^7
+    dq 0x0000000005F5E100, 0x0000002AF31DC461, 0x000000000091BF00, 0x000000000410D300, 0xC767074B22E90E21, 8   ; 10^8
+    dq 0x000000003B9ACA00, 0x000000044B82FA09, 0x000000002A4AE600, 0x000000002DC9FA00, 0x8E47CE423A2E9C6D, 9   ; 10^9
+
+; Первые SMALL_PRIMES простых (uint32_t)
+align 64
+global bignum_mod_u64_small_primes
+bignum_mod_u64_small_primes:
+    dd    2,    3,    5,    7,   11,   13,   17,   19,   23,   29,   31,   37,   41,   43,   47,   53
+    dd   59,   61,   67,   71,   73,   79,   83,   89,   97,  101,  103,  107,  109,  113,  127,  131
+    dd  137,  139,  149,  151,  157,  163,  167,  173,  179,  181,  191,  193,  197,  199,  211,  223
+    dd  227,  229,  233,  239,  241,  251,  257,  263,  269,  271,  277,  281,  283,  293,  307,  311
+    dd  313,  317,  331,  337,  347,  349,  353,  359,  367,  373,  379,  383,  389,  397,  401,  409
+    dd  419,  421,  431,  433,  439,  443,  449,  457,  461,  463,  467,  479,  487,  491,  499,  503
+    dd  509,  521,  523,  541,  547,  557,  563,  569,  571,  577,  587,  593,  599,  601,  607,  613
+    dd  617,  619,  631,  641,  643,  647,  653,  659,  661,  673,  677,  683,  691,  701,  709,  719
+    dd  727,  733,  739,  743,  751,  757,  761,  769,  773,  787,  797,  809,  811,  821,  823,  827
+    dd  829,  839,  853,  857,  859,  863,  877,  881,  883,  887,  907,  911,  919,  929,  937,  941
+    dd  947,  953,  967,  971,  977,  983,  991,  997, 1009, 1013, 1019, 1021, 1031, 1033, 1039, 1049
+    dd 1051, 1061, 1063, 1069, 1087, 1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163
+    dd 1171, 1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259, 1277, 1279, 1283
+    dd 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327, 1361, 1367, 1373, 1381, 1399, 1409, 1423
+    dd 1427, 1429, 1433, 1439, 1447, 1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511
+    dd 1523, 1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607, 1609, 1613, 1619
+
+; Те же простые: d, m, c1, c2 (первые SCTX_MOD_SIZE байт SCTX_*)
+align 64
+small_prime_ctx:
+    dq    2, 0x8000000000000000,    0,    0   ; [0]
+    dq    3, 0x5555555555555555,    1,    1   ; [1]
+    dq    5, 0x3333333333333333,    1,    1   ; [2]
+    dq    7, 0x2492492492492492,    2,    4   ; [3]
+    dq   11, 0x1745D1745D1745D1,    5,    3   ; [4]
+    dq   13, 0x13B13B13B13B13B1,    3,    9   ; [5]
+    dq   17, 0x0F0F0F0F0F0F0F0F,    1,    1   ; [6]
+    dq   19, 0x0D79435E50D79435,   17,    4   ; [7]
+    dq   23, 0x0B21642C8590B216,    6,   13   ; [8]
+    dq   29, 0x08D3DCB08D3DCB08,   24,   25   ; [9]
+    dq   31, 0x0842108421084210,   16,    8   ; [10]
+    dq   37, 0x06EB3E45306EB3E4,   12,   33   ; [11]
+    dq   41, 0x063E7063E7063E70,   16,   10   ; [12]
+    dq   43, 0x05F417D05F417D05,   41,    4   ; [13]
+    dq   47, 0x0572620AE4C415C9,   25,   14   ; [14]
+    dq   53, 0x04D4873ECADE304D,   15,   13   ; [15]
+    dq   59, 0x0456C797DD49C341,    5,   25   ; [16]
+    dq   61, 0x04325C53EF368EB0,   16,   12   ; [17]
+    dq   67, 0x03D226357E16ECE5,   17,   21   ; [18]
+    dq   71, 0x039B0AD12073615A,   10,   29   ; [19]
+    dq   73, 0x0381C0E070381C0E,    2,    4   ; [20]
+    dq   79, 0x033D91D2A2067B23,   51,   73   ; [21]
+    dq   83, 0x03159721ED7E7534,   36,   51   ; [22]
+    dq   89, 0x02E05C0B81702E05,   67,   39   ; [23]
+    dq   97, 0x02A3A0FD5C5F02A3,   61,   35   ; [24]
+    dq  101, 0x0288DF0CAC5B3F5D,   79,   80   ; [25]
+    dq  103, 0x027C45979C95204F,   55,   38   ; [26]
+    dq  107, 0x02647C69456217EC,   92,   11   ; [27]
+    dq  109, 0x02593F69B02593F6,   66,  105   ; [28]
+    dq  113, 0x0243F6F0243F6F02,   30,  109   ; [29]
+    dq  127, 0x0204081020408102,    2,    4   ; [30]
+    dq  131, 0x01F44659E4A42715,   65,   33   ; [31]
+    dq  137, 0x01DE5D6E3F8868A4,   60,   38   ; [32]
+    dq  139, 0x01D77B654B82C339,   13,   30   ; [33]
+    dq  149, 0x01B7D6C3DDA338B2,  102,  123   ; [34]
+    dq  151, 0x01B2036406C80D90,   16,  105   ; [35]
+    dq  157, 0x01A16D3F97A4B01A,   14,   39   ; [36]
+    dq  163, 0x01920FB49D0E228D,   57,  152   ; [37]
+    dq  167, 0x01886E5F0ABB0499,   49,   63   ; [38]
+    dq  173, 0x017AD2208E0ECC35,   47,  133   ; [39]
+    dq  179, 0x016E1F76B4337C6C,  124,  161   ; [40]
+    dq  181, 0x016A13CD15372904,   44,  126   ; [41]
+    dq  191, 0x01571ED3C506B39A,   26,  103   ; [42]
+    dq  193, 0x015390948F40FEAC,   84,  108   ; [43]
+    dq  197, 0x014CAB88725AF6E7,   61,  175   ; [44]
+    dq  199, 0x0149539E3B2D066E,  126,  155   ; [45]
+    dq  211, 0x013698DF3DE07479,   69,  119   ; [46]
+    dq  223, 0x0125E22708092F11,   49,  171   ; [47]
+    dq  227, 0x0120B470C67C0D88,  104,  147   ; [48]
+    dq  229, 0x011E2EF3B3FB8744,   44,  104   ; [49]
+    dq  233, 0x0119453808CA29C0,   64,  135   ; [50]
+    dq  239, 0x0112358E75D30336,  150,   34   ; [51]
+    dq  241, 0x010FEF010FEF010F,  225,   15   ; [52]
+    dq  251, 0x0105197F7D734041,   69,  243   ; [53]
+    dq  257, 0x00FF00FF00FF00FF,    1,    1   ; [54]
+    dq  263, 0x00F92FB2211855A8,  104,   33   ; [55]
+    dq  269, 0x00F3A0D52CBA8723,   57,   21   ; [56]
+    dq  271, 0x00F1D48BCEE0D399,  265,   36   ; [57]
+    dq  277, 0x00EC979118F3FC4D,  175,  155   ; [58]
+    dq  281, 0x00E939651FE2D8D3,  101,   85   ; [59]
+    dq  283, 0x00E79372E225FE30,  240,  151   ; [60]
+    dq  293, 0x00DFAC1F74346C57,  109,  161   ; [61]
+    dq  307, 0x00D578E97C3F5FE5,   97,  199   ; [62]
+    dq  311, 0x00D2BA083B445250,  208,   35   ; [63]
+    dq  313, 0x00D161543E28E502,  142,  132   ; [64]
+    dq  317, 0x00CEBCF8BB5B4169,  251,  235   ; [65]
+    dq  331, 0x00C5FE740317F9D0,   16,  256   ; [66]
+    dq  337, 0x00C2780613C0309E,    2,    4   ; [67]
+    dq  347, 0x00BCDD535DB1CC5B,  167,  129   ; [68]
+    dq  349, 0x00BBC8408CD63069,  219,  148   ; [69]
+    dq  353, 0x00B9A7862A0FF465,  187,   22   ; [70]
+    dq  359, 0x00B68D31340E4307,  303,  264   ; [71]
+    dq  367, 0x00B2927C29DA5519,  297,  129   ; [72]
+    dq  373, 0x00AFB321A1496FDF,   21,   68   ; [73]
+    dq  379, 0x00ACEB0F891E6551,  277,  171   ; [74]
+    dq  383, 0x00AB1CBDD3E2970F,  143,  150   ; [75]
+    dq  389, 0x00A87917088E262B,  169,  164   ; [76]
+    dq  397, 0x00A513FD6BB00A51,   99,  273   ; [77]
+    dq  401, 0x00A36E71A2CB0331,   63,  360   ; [78]
+    dq  409, 0x00A03C1688732B30,   80,  265   ; [79]
+    dq  419, 0x009C69169B30446D,  409,  100   ; [80]
+    dq  421, 0x009BAADE8E4A2F6E,   26,  255   ; [81]
+    dq  431, 0x00980E4156201301,  337,  216   ; [82]
+    dq  433, 0x00975A750FF68A58,  296,  150   ; [83]
+    dq  439, 0x009548E4979E0829,  433,   36   ; [84]
+    dq  443, 0x0093EFD1C50E726B,  215,  153   ; [85]
+    dq  449, 0x0091F5BCB8BB02D9,  359,   18   ; [86]
+    dq  457, 0x008F67A1E3FDC261,  215,   68   ; [87]
+    dq  461, 0x008E2917E0E702C6,  370,  444   ; [88]
+    dq  463, 0x008D8BE33F95D715,  261,   60   ; [89]
+    dq  467, 0x008C55841C815ED5,  369,  264   ; [90]
+    dq  479, 0x0088D180CD3A4133,  403,   28   ; [91]
+    dq  487, 0x00869222B1ACF1CE,  286,  467   ; [92]
+    dq  491, 0x0085797B917765AB,  263,  429   ; [93]
+    dq  499, 0x008355ACE3C897DB,   31,  462   ; [94]
+    dq  503, 0x00824A4E60B3262B,  387,  378   ; [95]
+    dq  509, 0x0080C121B28BD1BA,  302,   93   ; [96]
+    dq  521, 0x007DC9F3397D4C29,  143,  130   ; [97]
+    dq  523, 0x007D4ECE8FE88139,  141,    7   ; [98]
+    dq  541, 0x0079237D65BCCE50,  240,  254   ; [99]
+    dq  547, 0x0077CF53C5F7936C,   60,  318   ; [100]
+    dq  557, 0x0075A8ACCFBDD11E,  442,  414   ; [101]
+    dq  563, 0x007467AC557C228E,  438,  424   ; [102]
+    dq  569, 0x00732D70ED8DB8E9,  543,  107   ; [103]
+    dq  571, 0x0072C62A24C3797F,  443,  396   ; [104]
+    dq  577, 0x007194A17F55A10D,  435,  546   ; [105]
+    dq  587, 0x006FA549B41DA7E7,  339,  456   ; [106]
+    dq  593, 0x006E8419E6F61221,  399,  277   ; [107]
+    dq  599, 0x006D68B5356C207B,   51,  205   ; [108]
+    dq  601, 0x006D0B803685C01B,  157,    8   ; [109]
+    dq  607, 0x006BF790A8B2D207,  359,  197   ; [110]
+    dq  613, 0x006AE907EF4B96C2,  374,  112   ; [111]
+    dq  617, 0x006A37991A23AEAD,  267,  334   ; [112]
+    dq  619, 0x0069DFBDD4295B66,   94,  170   ; [113]
+    dq  631, 0x0067DC4C45C8033E,  558,  281   ; [114]
+    dq  641, 0x00663D80FF99C27F,    1,    1   ; [115]
+    dq  643, 0x0065EC17E3559948,   40,  314   ; [116]
+    dq  647, 0x00654AC835CFBA5C,  380,  119   ; [117]
+    dq  653, 0x00645C854AE10772,  566,  386   ; [118]
+    dq  659, 0x006372990E5F901F,   51,  624   ; [119]
+    dq  661, 0x006325913C07BEEF,  229,  222   ; [120]
+    dq  673, 0x006160FF9E9F0061,  255,  417   ; [121]
+    dq  677, 0x0060CDB520E5E88E,  122,  667   ; [122]
+    dq  683, 0x005FF4017FD005FF,  171,  555   ; [123]
+    dq  691, 0x005ED79E31A4DCCD,  681,  100   ; [124]
+    dq  701, 0x005D7D42D48AC5EF,  141,  253   ; [125]
+    dq  709, 0x005C6F35CCBA5028,  312,  211   ; [126]
+    dq  719, 0x005B2618EC6AD0A5,  149,  631   ; [127]
+    dq  727, 0x005A2553748E42E7,  511,  128   ; [128]
+    dq  733, 0x0059686CF744CD5B,  625,  669   ; [129]
+    dq  739, 0x0058AE97BAB79976,   94,  707   ; [130]
+    dq  743, 0x0058345F1876865F,  583,  338   ; [131]
+    dq  751, 0x005743D5BB24795A,  250,  167   ; [132]
+    dq  757, 0x005692C4D1AB74AB,  601,  112   ; [133]
+    dq  761, 0x00561E46A4D5F337,  385,  591   ; [134]
+    dq  769, 0x005538ED06533997,  361,  360   ; [135]
+    dq  773, 0x0054C807F2C0BEC2,   54,  597   ; [136]
+    dq  787, 0x005345EFBC572D36,  766,  441   ; [137]
+    dq  797, 0x00523A758F941345,  559,   57   ; [138]
+    dq  809, 0x005102370F816C89,  783,  676   ; [139]
+    dq  811, 0x0050CF129FB94ACF,  571,   19   ; [140]
+    dq  821, 0x004FD31941CAFDD1,  187,  487   ; [141]
+    dq  823, 0x004FA1704AA75945,  813,  100   ; [142]
+    dq  827, 0x004F3ED6D45A63AD,   33,  262   ; [143]
+    dq  829, 0x004F0DE57154EBED,  391,  345   ; [144]
+    dq  839, 0x004E1CAE8815F811,   73,  295   ; [145]
+    dq  853, 0x004CD47BA5F6FF19,  435,  712   ; [146]
+    dq  857, 0x004C78AE734DF709,  735,  315   ; [147]
+    dq  859, 0x004C4B19ED85CFB8,  408,  677   ; [148]
+    dq  863, 0x004BF093221D1218,  280,  730   ; [149]
+    dq  877, 0x004ABA3C21DC633F,  301,  270   ; [150]
+    dq  881, 0x004A6360C344DE00,  512,  487   ; [151]
+    dq  883, 0x004A383E9F74D68A,  514,  179   ; [152]
+    dq  887, 0x0049E28FBABB9940,  832,  364   ; [153]
+    dq  907, 0x0048417B57C78CD7,  579,  558   ; [154]
+    dq  911, 0x0047F043713F3A2B,  251,  142   ; [155]
+    dq  919, 0x00474FF2A10281CF,  487,   67   ; [156]
+    dq  929, 0x00468B6F9A978F91,  719,  437   ; [157]
+    dq  937, 0x0045F13F1CAFF2E2,  718,  174   ; [158]
+    dq  941, 0x0045A5228CEC23E9,  139,  501   ; [159]
+    dq  947, 0x0045342C556C66B9,  421,  152   ; [160]
+    dq  953, 0x0044C4A23FEECED7,  417,  443   ; [161]
+    dq  967, 0x0043C5C20D3C9FE6,  566,  279   ; [162]
+    dq  971, 0x00437E494B239798,  632,  343   ; [163]
+    dq  977, 0x0043142D118E47CB,  581,  496   ; [164]
+    dq  983, 0x0042AB5C73A13458,  536,  260   ; [165]
+    dq  991, 0x004221950DB0F3DB,  827,  139   ; [166]
+    dq  997, 0x0041BBB2F80A4553,  961,  299   ; [167]
+    dq 1009, 0x0040F391612C6680,  384,  142   ; [168]
+    dq 1013, 0x0040B1E94173FEFD,  223,   92   ; [169]
+    dq 1019, 0x004050647D9D0445,  345,  821   ; [170]
+    dq 1021, 0x004030241B144F3B,  433,  646   ; [171]
+    dq 1031, 0x003F90C2AB542CB1,  809,  827   ; [172]
+    dq 1033, 0x003F71412D59F597,  433,  516   ; [173]
+    dq 1039, 0x003F137701B98841,   49,  323   ; [174]
+    dq 1049, 0x003E79886B60E278,  584,  131   ; [175]
+    dq 1051, 0x003E5B1916A7181D,  241,  276   ; [176]
+    dq 1061, 0x003DC4A50968F524,  460,  461   ; [177]
+    dq 1063, 0x003DA6E4C9550321,  505,  968   ; [178]
+    dq 1069, 0x003D4E4F06F1DEF3,  841,  672   ; [179]
+    dq 1087, 0x003C4A6BDD24F9A4,  164,  808   ; [180]
+    dq 1091, 0x003C11D54B525C73,  487,  422   ; [181]
+    dq 1093, 0x003BF5B1C5721065,  199,  253   ; [182]
+    dq 1097, 0x003BBDB9862F23B4,  428, 1082   ; [183]
+    dq 1103, 0x003B6A8801DB5440,   64,  787   ; [184]
+    dq 1109, 0x003B183CF0FED886,  898,  161   ; [185]
+    dq 1117, 0x003AABE394BDC3F4,   92,  645   ; [186]
+    dq 1123, 0x003A5BA3E76156DA,  434,  815   ; [187]
+    dq 1129, 0x003A0C3E953378DB,  557,  903   ; [188]
+    dq 1151, 0x0038F03561320B1E, 1054,  201   ; [189]
+    dq 1153, 0x0038D6ECAEF5908A,  630,  268   ; [190]
+    dq 1163, 0x003859CF221E6069,  765,  236   ; [191]
+    dq 1171, 0x0037F7415DC9588A,  194,  164   ; [192]
+    dq 1181, 0x00377DF0D3902626,  690,  157   ; [193]
+    dq 1187, 0x00373622136907FA,  978,  949   ; [194]
+    dq 1193, 0x0036EF0C3B39B92F, 1017, 1151   ; [195]
+    dq 1201, 0x0036915F47D55E6D,  675,  446   ; [196]
+    dq 1213, 0x0036072CF3F866FD,  823,  475   ; [197]
+    dq 1217, 0x0035D9B737BE5EA8,  856,  102   ; [198]
+    dq 1223, 0x0035961559CC81C7,  591,  726   ; [199]
+    dq 1229, 0x0035531C897A4592,  534,   28   ; [200]
+    dq 1231, 0x00353CEEBD3E98A4,  868,   52   ; [201]
+    dq 1237, 0x0034FAD381585E5E,  970,  780   ; [202]
+    dq 1249, 0x00347884D1103130, 1232,  289   ; [203]
+    dq 1259, 0x00340DD3AC39BF56, 1038,  999   ; [204]
+    dq 1277, 0x003351FDFECC140C,   36,   19   ; [205]
+    dq 1279, 0x00333D72B089B524,  292,  850   ; [206]
+    dq 1283, 0x0033148D44D6B261,  989,  475   ; [207]
+    dq 1289, 0x0032D7AEF8412458,  232,  975   ; [208]
+    dq 1291, 0x0032C3850E79C0F1,  165,  114   ; [209]
+    dq 1297, 0x00328766D59048A2,  830,  193   ; [210]
+    dq 1301, 0x00325FA18CB11833, 1233,  721   ; [211]
+    dq 1303, 0x00324BD659327E22,  242, 1232   ; [212]
+    dq 1307, 0x0032246E784360F4,  580,  501   ; [213]
+    dq 1319, 0x0031AFA5F1A33A08,  200,  430   ; [214]
+    dq 1321, 0x00319C63FF398E70,   16,  256   ; [215]
+    dq 1327, 0x003162F7519A86A7, 1111,  211   ; [216]
+    dq 1361, 0x0030271FC9D3FC3C, 1284,  485   ; [217]
+    dq 1367, 0x002FF104AE89750B,  579,  326   ; [218]
+    dq 1373, 0x002FBB62A236D133,  377,  710   ; [219]
+    dq 1381, 0x002F74997D2070B4, 1276, 1358   ; [220]
+    dq 1399, 0x002ED84AA8B6FCE3,  891,  648   ; [221]
+    dq 1409, 0x002E832DF7A46DBD,  707, 1063   ; [222]
+    dq 1423, 0x002E0E0846857CAB, 1403,  400   ; [223]
+    dq 1427, 0x002DECFBDFB55EE6, 1006,  293   ; [224]
+    dq 1429, 0x002DDC876F3FF488, 1240, 1425   ; [225]
+    dq 1433, 0x002DBBC1D4C482C4, 1244, 1329   ; [226]
+    dq 1439, 0x002D8AF0E0DE0556,  406,  790   ; [227]
+    dq 1447, 0x002D4A7B7D14B30A,  634, 1137   ; [228]
+    dq 1451, 0x002D2A85073BCF4E,  230,  664   ; [229]
+    dq 1453, 0x002D1A9AB13E8BE4,  748,   99   ; [230]
+    dq 1459, 0x002CEB1EB4B9FD8B,  207,  538   ; [231]
+    dq 1471, 0x002C8D503A79794C, 1100,  838   ; [232]
+    dq 1481, 0x002C404D708784ED,  235,  428   ; [233]
+    dq 1483, 0x002C31066315EC52,  250,  214   ; [234]
+    dq 1487, 0x002C1297D80F2664,  292,  505   ; [235]
+    dq 1489, 0x002C037044C55F6B,  677, 1206   ; [236]
+    dq 1493, 0x002BE5404CD13086,  642,   96   ; [237]
+    dq 1499, 0x002BB845ADAF0CCE, 1478,  441   ; [238]
+    dq 1511, 0x002B5F62C639F16D, 1445, 1334   ; [239]
+    dq 1523, 0x002B07E6734F2B88, 1512,  121   ; [240]
+    dq 1531, 0x002ACE569D8342B7,  915, 1299   ; [241]
+    dq 1543, 0x002A791D5DBD4DCF, 1367,  116   ; [242]
+    dq 1549, 0x002A4EFF8113017C, 1204, 1301   ; [243]
+    dq 1553, 0x002A3319E156DF32,  430,   93   ; [244]
+    dq 1559, 0x002A0986286526EA, 1274,  157   ; [245]
+    dq 1567, 0x0029D29551D91E39,  281,  611   ; [246]
+    dq 1571, 0x0029B7529E109F0A, 1442,  931   ; [247]
+    dq 1579, 0x00298137491EA465, 1289,  413   ; [248]
+    dq 1583, 0x0029665E1EB9F9DA, 1274,  501   ; [249]
+    dq 1597, 0x002909752E019A5E,  922,  480   ; [250]
+    dq 1601, 0x0028EF35E2E5EFB0, 1104,  455   ; [251]
+    dq 1607, 0x0028C815AA4B8278,  184,  109   ; [252]
+    dq 1609, 0x0028BB1B867199DA, 1238,  876   ; [253]
+    dq 1613, 0x0028A13FF5D7B002,  870,  403   ; [254]
+    dq 1619, 0x00287AB3F173E755,  369,  165   ; [255]
+
+section .text
+
+; =============================================================================
+; @brief      Делит большое число на 10^k по встроенной таблице.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: bignum_t *q        (Указатель на структуру для частного)
+;   - `rsi`: const bignum_t *n  (Указатель на структуру делимого)
+;   - `edx`: unsigned k         (Показатель, 0 <= k <= POW10_MAX)
+;   - `rcx`: uint64_t *rem      (Указатель на 64-битный остаток)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   k проверяется первым; остальные проверки выполняет ядро.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -3, -4, -5)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_div_u64_pow10
+
+bignum_div_u64_pow10:
+    mov     eax, edx
+    cmp     eax, POW10_MAX
+    ja      .err_unsupported
+%if SMALL_MIN_LEN <= BIGNUM_CAPACITY
+    lea     edx, [rax - 1]
+    cmp     edx, POW10_SMALL_MAX - 1
+    ja      .reciprocal                 ; k = 0 или 10^k >= 2^32
+    test    rsi, rsi
+    jz      .reciprocal                 ; ошибку вернёт ядро
+    cmp     dword [rsi + BIGNUM_LEN_OFFSET], SMALL_MIN_LEN
+    jl      .reciprocal
+    imul    edx, edx, SCTX_SIZE
+    lea     rax, [rel pow10_small]
+    add     rdx, rax
+    jmp     bignum_div_u64_small_pre
+.reciprocal:
+%endif
+    imul    eax, eax, CTX_SIZE
+    lea     rdx, [rel bignum_div_u64_pow10_ctx]
+    add     rdx, rax
+    jmp     bignum_div_u64_ctx_dispatch
+
+.err_unsupported:
+    mov     eax, BIGNUM_DIV_U64_ERR_UNSUPPORTED
+    ret
+
+; =============================================================================
+; @brief      Вычисляет остаток от деления на малое простое из таблицы.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n  (Указатель на структуру делимого)
+;   - `esi`: unsigned idx       (Номер простого, 0 <= idx < SMALL_PRIMES)
+;   - `rdx`: uint64_t *rem      (Указатель на 64-битный остаток)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   Порядок проверок: idx, NULL, длина. Остаток продвигается по два слова:
+;   K = (a * c1 + b) mod p для пары слов (a, b) не зависит от цепочки, и на
+;   цепочке остаётся r' = (r * c2 + K) mod p — одно приведение на два слова.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -4, -5)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_mod_u64_small_prime
+
+bignum_mod_u64_small_prime:
+    ; 1. Валидация входных данных
+    mov     eax, esi
+    cmp     eax, SMALL_PRIMES
+    jae     .err_unsupported
+    test    rdi, rdi
+    jz      .err_null_ptr
+    test    rdx, rdx
+    jz      .err_null_ptr
+    mov     r9d, [rdi + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r14
+
+    mov     rsi, rdi                    ; n->words
+    mov     rdi, rdx                    ; rem
+    imul    eax, eax, SCTX_MOD_SIZE
+    lea     rcx, [rel small_prime_ctx]
+    add     rcx, rax
+    mov     r14, [rcx + SCTX_D_OFFSET]
+    mov     rbx, [rcx + SCTX_M_OFFSET]
+    mov     rbp, [rcx + SCTX_C1_OFFSET]
+    mov     r12, [rcx + SCTX_C2_OFFSET]
+
+    ; 2. Цепочка остатков по два слова
+    xor     r8d, r8d                    ; r
+    test    r9d, 1
+    jz      .pair_check
+    dec     r9
+    mov     r8, [rsi + r9 * 8]
+    SMALL_REDUCE r8                     ; r = n[top] mod p
+    jmp     .pair_check
+.pair_loop:
+    mov     r10, [rsi + r9 * 8 - 8]
+    SMALL_REDUCE r10                    ; a = n[i] mod p
+    mov     r11, [rsi + r9 * 8 - 16]
+    SMALL_REDUCE r11                    ; b = n[i-1] mod p
+    imul    r10, rbp
+    add     r11, r10
+    SMALL_REDUCE r11                    ; K = (a * c1 + b) mod p
+    imul    r8, r12
+    add     r8, r11
+    SMALL_REDUCE r8                     ; r = (r * c2 + K) mod p
+    sub     r9, 2
+.pair_check:
+    cmp     r9, 2
+    jae     .pair_loop
+
+    mov     [rdi], r8
+
+    ; --- Эпилог ---
+    pop     r14
+    pop     r12
+    pop     rbp
+    pop     rbx
+    mov     eax, BIGNUM_DIV_U64_OK
+    ret
+
+.err_unsupported:
+    mov     eax, BIGNUM_DIV_U64_ERR_UNSUPPORTED
+    ret
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    ret
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    ret
@@ -0,0 +1,202 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_divexact_u64.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    16.10.2026
+;
+; @brief   Точное деление большого числа на uint64_t (d делит n нацело).
+;
+; @details
+;   Реализует функцию bignum_divexact_u64 на ассемблере x86-64 (синтаксис
+;   YASM) в соответствии с System V AMD64 ABI. Частное вычисляется от
+;   младшего слова к старшему умножением на обратную к нечётной части d по
+;   модулю 2^64 (Jebelean): ни `div`, ни 128-битной цепочки остатка.
+;   Степень двойки в d убирается сдвигом делимого "на лету" (`shrd`).
+;   Делимые короче DIVEXACT_MIN_LEN слов передаются bignum_div_u64.
+;
+; @history
+;   - rev. 1 (16.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+extern bignum_div_u64
+
+section .text
+
+; =============================================================================
+; @brief      Делит n на d, если известно, что d делит n нацело.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: bignum_t *q             (Указатель на структуру для частного)
+;   - `rsi`: const bignum_t *n       (Указатель на структуру делимого)
+;   - `rdx`: uint64_t d              (64-битный делитель)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** как в bignum_div_u64 (без rem). При
+;       n->len < DIVEXACT_MIN_LEN — вызов bignum_div_u64 с остатком на стеке.
+;   2.  **Подготовка:** d = d' * 2^s, d' нечётно; inv = d'^-1 mod 2^64
+;       итерациями Ньютона x = x * (2 - d' * x) от 5 верных бит (3d' xor 2).
+;   3.  **Цикл:** для i = 0..len-1: u = (n >> s).words[i],
+;       q_i = (u - c) * inv, c = hi(q_i * d') + [u < c]. Слово
+;       q->words[i] пишется после чтения n->words[i + 1], поэтому
+;       допускается q == n.
+;   4.  **Нормализация:** поле len и хвост bignum_t; хвост обнуляется
+;       парами слов (`movups`), без запуска `rep stosq`.
+;
+;   Если d не делит n, частное не определено (контракт len и хвоста
+;   соблюдается).
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -3, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11, xmm0
+; =============================================================================
+align 16
+global bignum_divexact_u64
+
+bignum_divexact_u64:
+    ; --- Пролог ---
+    push    rbx
+    push    r12
+    push    r13
+    push    r14
+
+    mov     r12, rdi    ; q
+    mov     r13, rsi    ; n
+    mov     r14, rdx    ; d
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      .err_null_ptr
+    test    r13, r13
+    jz      .err_null_ptr
+
+    mov     r9d, [r13 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    test    r14, r14
+    jz      .err_div_by_zero
+
+    cmp     r12, r13
+    je      .no_overlap
+    lea     rax, [r13 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r12, rax
+    jae     .no_overlap
+    lea     rax, [r12 + BIGNUM_T_SIZE_ALIGNED]
+    cmp     r13, rax
+    jb      .err_buffer_overlap
+.no_overlap:
+
+    cmp     r9d, DIVEXACT_MIN_LEN
+    jl      .short
+
+    mov     r11, r9                     ; n->len для нормализации
+
+    ; 2. d' = d >> s и обратная к d' по модулю 2^64
+    bsf     rcx, r14
+    shr     r14, cl
+    lea     rbx, [r14 + r14 * 2]
+    xor     rbx, 2                      ; 5 верных бит
+%rep 4
+    mov     rax, r14
+    imul    rax, rbx
+    neg     rax
+    add     rax, 2                      ; 2 - d' * x
+    imul    rbx, rax                    ; 10, 20, 40, 64 бита
+%endrep
+
+    ; 3. Цикл от младшего слова; r8 = перенос c, r10 = i
+    xor     r8d, r8d
+    xor     r10d, r10d
+    mov     rsi, [r13]
+    dec     r9
+    jz      .last_word
+.main_loop:
+    mov     rdi, [r13 + r10 * 8 + 8]
+    shrd    rsi, rdi, cl                ; u = слово n >> s
+    sub     rsi, r8
+    sbb     r8, r8                      ; -[u < c]
+    imul    rsi, rbx                    ; q_i
+    mov     [r12 + r10 * 8], rsi
+    mov     rax, rsi
+    mul     r14
+    sub     rdx, r8
+    mov     r8, rdx                     ; c = hi(q_i * d') + [u < c]
+    mov     rsi, rdi
+    inc     r10
+    cmp     r10, r9
+    jne     .main_loop
+.last_word:
+    shr     rsi, cl
+    sub     rsi, r8
+    imul    rsi, rbx
+    mov     [r12 + r10 * 8], rsi
+
+    ; 4. Длина и хвост частного
+.find_len:
+    test    r11, r11
+    jz      .set_len
+    cmp     qword [r12 + r11 * 8 - 8], 0
+    jne     .set_len
+    dec     r11
+    jmp     .find_len
+.set_len:
+    mov     [r12 + BIGNUM_LEN_OFFSET], r11d
+    ; хвост парами слов: короткий цикл быстрее запуска rep stosq
+    lea     rdi, [r12 + r11 * 8]
+    lea     rcx, [r12 + BIGNUM_CAPACITY * 8]
+    xorps   xmm0, xmm0
+    mov     eax, BIGNUM_CAPACITY
+    sub     eax, r11d
+    test    al, 1
+    jz      .clear_pairs
+    mov     qword [rdi], 0              ; нечётное число слов хвоста
+    add     rdi, 8
+.clear_pairs:
+    cmp     rdi, rcx
+    jae     .done
+    movups  [rdi], xmm0
+    add     rdi, 16
+    jmp     .clear_pairs
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.short:
+    mov     rdi, r12
+    mov     rsi, r13
+    mov     rdx, r14
+    sub     rsp, 8
+    mov     rcx, rsp                    ; остаток (равен 0) не нужен
+    call    bignum_div_u64
+    add     rsp, 8
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.err_buffer_overlap:
+    mov     eax, BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP
+
+.exit:
+    ; --- Эпилог ---
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbx
+    ret
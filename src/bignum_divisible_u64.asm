@@ -0,0 +1,450 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_divisible_u64.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    16.10.2026
+;
+; @brief   Проверка делимости большого числа на uint64_t без вычисления частного.
+;
+; @details
+;   Реализует функции bignum_divisible_u64 и bignum_divisible_u64_multi на
+;   ассемблере x86-64 (синтаксис YASM) в соответствии с System V AMD64 ABI.
+;
+;   d = d' * 2^s, d' нечётно. Делимость на 2^s видна по младшему слову, и
+;   при её отсутствии ответ готов без обращения d'. Делимость на d'
+;   проверяется двумя независимыми цепочками, которые процессор выполняет
+;   одновременно:
+;   - младшие m = ceil(len/2) слов L — от младшего к старшему умножением
+;     на d'^-1 mod 2^64 (как в bignum_divexact_u64): L = Q * d' - c * 2^(64m);
+;   - старшие len - m слов H — от старшего к младшему шагами
+;     DIV_2BY1_PREINV: h = H mod d'.
+;   Тогда n = H * 2^(64m) + L = (H - c) * 2^(64m) + Q * d', и так как d'
+;   нечётно, d' | n тогда и только тогда, когда h == c mod d' (c <= d').
+;
+; @history
+;   - rev. 1 (16.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+; =============================================================================
+; @brief  Шаг младшей цепочки: c = hi(((u - c) * inv) * d') + [u < c].
+;
+; @param  r13  [in/out] указатель на слово u, сдвигается на следующее
+; @param  r11  [in/out] перенос c
+; @param  rbp  [in]     inv = d'^-1 mod 2^64
+; @param  r15  [in]     d'
+; @clobbers rax, rdx, flags
+; =============================================================================
+%macro EXACT_CARRY_STEP 0
+    mov     rax, [r13]
+    sub     rax, r11
+    sbb     r11, r11                    ; -[u < c]
+    imul    rax, rbp
+    mul     r15
+    sub     rdx, r11
+    mov     r11, rdx
+    add     r13, 8
+%endmacro
+
+; =============================================================================
+; @brief  Проверяет, делит ли d число n (n->len >= 1).
+;
+; @details
+;   1.  **Степень двойки:** младшие s бит n->words[0] должны быть нулями;
+;       d = 2^s на этом завершается.
+;   2.  **Подготовка:** inv = d'^-1 mod 2^64 (Ньютон от 5 бит) и обратная
+;       величина нормализованного d' (PREINV_SETUP) — независимы.
+;   3.  **Цепочки:** при нечётной длине — один шаг младшей цепочки, затем
+;       парами: шаг DIV_2BY1_PREINV по старшему слову и шаг младшей цепочки.
+;   4.  **Сравнение:** h == c mod d'.
+;
+; @param  r12  [in] n
+; @param  r9   [in] n->len (>= 1)
+; @param  r15  [in] d (!= 0)
+; @return eax = 1, если d | n, иначе 0
+; @clobbers rbx, rcx, rdx, rbp, rsi, rdi, r8–r11, r13–r15, flags
+; =============================================================================
+%macro DIVISIBLE_CORE 0
+    ; 1. Степень двойки в d
+    bsf     rcx, r15
+    mov     rax, [r12]
+    mov     rdx, rax
+    shr     rdx, cl
+    shl     rdx, cl
+    cmp     rdx, rax
+    jne     %%not_divisible             ; младшие s бит не нули
+    shr     r15, cl                     ; d'
+    cmp     r15, 1
+    je      %%divisible
+
+    ; 2. inv = d'^-1 mod 2^64; dnorm, v, shift для старшей цепочки
+    lea     rbp, [r15 + r15 * 2]
+    xor     rbp, 2                      ; 5 верных бит
+%rep 4
+    mov     rax, r15
+    imul    rax, rbp
+    neg     rax
+    add     rax, 2                      ; 2 - d' * x
+    imul    rbp, rax                    ; 10, 20, 40, 64 бита
+%endrep
+    mov     r14, r15
+    PREINV_SETUP r14, rbx               ; r14 = dnorm, rbx = v, rcx = shift
+
+    ; 3. Цепочки: r13 — младшее слово, r11 = c; rsi — старшее слово, r8 = r
+    mov     r13, r12
+    xor     r11d, r11d
+    xor     r8d, r8d
+    mov     r10, r9
+    shr     r10, 1                      ; len - m старших слов
+    jz      %%low_only                  ; len == 1
+    test    r9, 1
+    jz      %%high_init
+    EXACT_CARRY_STEP                    ; нечётная длина: лишнее младшее слово
+%%high_init:
+    lea     rdi, [r12 + r9 * 8 - 16]
+    mov     rsi, [rdi + 8]
+    shld    r8, rsi, cl
+    lea     r9, [r10 - 1]
+    test    r9, r9
+    jz      %%last_pair
+%%pair_loop:
+    mov     r10, [rdi]
+    shld    rsi, r10, cl
+    DIV_2BY1_PREINV r10, r8, rsi, r14, rbx
+    mov     rsi, [rdi]
+    sub     rdi, 8
+    EXACT_CARRY_STEP
+    dec     r9
+    jnz     %%pair_loop
+%%last_pair:
+    shl     rsi, cl
+    DIV_2BY1_PREINV r10, r8, rsi, r14, rbx
+    EXACT_CARRY_STEP
+    shr     r8, cl                      ; h = H mod d'
+    jmp     %%compare
+
+%%low_only:
+    EXACT_CARRY_STEP
+
+    ; 4. d' | n <=> h == c mod d'
+%%compare:
+    xor     eax, eax
+    cmp     r11, r15
+    cmove   r11, rax                    ; c == d' -> 0
+    cmp     r8, r11
+    sete    al
+    jmp     %%done
+
+%%divisible:
+    mov     eax, 1
+    jmp     %%done
+%%not_divisible:
+    xor     eax, eax
+%%done:
+%endmacro
+
+section .text
+
+; =============================================================================
+; @brief      Проверяет, делится ли n на d.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n       (Указатель на структуру делимого)
+;   - `rsi`: uint64_t d              (64-битный делитель)
+;   - `rdx`: bool *divisible         (Указатель на результат)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   Валидация — как в bignum_mod_u64; n = 0 делится на любое d, иначе
+;   DIVISIBLE_CORE.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_divisible_u64
+
+bignum_divisible_u64:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    push    rdx         ; divisible
+
+    mov     r12, rdi    ; n
+    mov     r15, rsi    ; d
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      .err_null_ptr
+    test    rdx, rdx
+    jz      .err_null_ptr
+
+    mov     r9d, [r12 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    test    r15, r15
+    jz      .err_div_by_zero
+
+    ; 2. Проверка делимости
+    mov     eax, 1
+    test    r9, r9
+    jz      .store                      ; n = 0
+    DIVISIBLE_CORE
+.store:
+    mov     rdx, [rsp]
+    mov     [rdx], al
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+
+.exit:
+    ; --- Эпилог ---
+    pop     rdx
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
+
+; =============================================================================
+; @brief      Проверяет делимость n на каждый из k делителей.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n       (Указатель на структуру делимого)
+;   - `rsi`: const uint64_t *d       (Массив делителей)
+;   - `rdx`: size_t k                (Число делителей)
+;   - `rcx`: bool *divisible         (Массив из k результатов)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** как в bignum_mod_u64_multi; все делители проверяются
+;       до записи результатов.
+;   2.  **Группы:** по DIVISIBLE_LANES делителей. Для каждого — проверка
+;       младших s бит и inv = d'^-1 mod 2^64; `div` не нужен.
+;   3.  **Цепочки:** младшая цепочка EXACT_CARRY_STEP по всем словам n для
+;       всех делителей группы: слово читается один раз на группу, цепочки
+;       независимы и перекрываются. n = Q * d' - c * 2^(64 len), поэтому
+;       d' | n тогда и только тогда, когда c == 0 или c == d'.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+
+%define DIVISIBLE_LANES 4       ; делителей на проход по словам n
+
+%define F_N     0       ; const bignum_t *n
+%define F_END   8       ; &n->words[n->len]
+%define F_D     16      ; делители текущей группы
+%define F_K     24      ; оставшееся число делителей
+%define F_OUT   32      ; результаты текущей группы
+%define F_G     40      ; делителей в группе
+%define F_SIZE  48
+
+; -----------------------------------------------------------------------------
+; Полоса %1 группы: %2 = inv, %3 = d'; divisible[%1] = (младшие s бит нули).
+; Полосы за пределами группы получают d' = inv = 1 и не пишут результат.
+; @clobbers rax, rcx, rdx, flags
+; -----------------------------------------------------------------------------
+%macro LANE_SETUP 3
+    mov     %3, 1
+    mov     %2, 1
+    cmp     qword [rsp + F_G], %1
+    jbe     %%done
+    mov     rax, [rsp + F_D]
+    mov     %3, [rax + %1 * 8]
+    bsf     rcx, %3
+    mov     rax, [rsp + F_N]
+    mov     rax, [rax]                  ; n->words[0]
+    mov     rdx, rax
+    shr     rdx, cl
+    shl     rdx, cl
+    cmp     rdx, rax
+    mov     rax, [rsp + F_OUT]
+    sete    byte [rax + %1]
+    shr     %3, cl                      ; d'
+    lea     %2, [%3 + %3 * 2]
+    xor     %2, 2                       ; 5 верных бит
+%rep 4
+    mov     rax, %3
+    imul    rax, %2
+    neg     rax
+    add     rax, 2
+    imul    %2, rax                     ; 10, 20, 40, 64 бита
+%endrep
+%%done:
+%endmacro
+
+; -----------------------------------------------------------------------------
+; Шаг полосы по слову [rcx]: %1 = c, %2 = inv, %3 = d'.
+; @clobbers rax, rdx, flags
+; -----------------------------------------------------------------------------
+%macro LANE_STEP 3
+    mov     rax, [rcx]
+    sub     rax, %1
+    sbb     %1, %1
+    imul    rax, %2
+    mul     %3
+    sub     rdx, %1
+    mov     %1, rdx
+%endmacro
+
+; -----------------------------------------------------------------------------
+; Итог полосы %1: divisible[%1] &= (c == 0 || c == d'); %2 = c, %3 = d'.
+; @clobbers rax, rdx, flags
+; -----------------------------------------------------------------------------
+%macro LANE_FINISH 3
+    cmp     qword [rsp + F_G], %1
+    jbe     %%done
+    xor     eax, eax
+    cmp     %2, %3
+    cmove   %2, rax
+    test    %2, %2
+    sete    al
+    mov     rdx, [rsp + F_OUT]
+    and     [rdx + %1], al
+%%done:
+%endmacro
+
+align 16
+global bignum_divisible_u64_multi
+
+bignum_divisible_u64_multi:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, F_SIZE
+
+    mov     [rsp + F_N], rdi
+    mov     [rsp + F_D], rsi
+    mov     [rsp + F_K], rdx
+    mov     [rsp + F_OUT], rcx
+
+    ; 1. Валидация входных данных
+    test    rdi, rdi
+    jz      .err_null_ptr
+    test    rsi, rsi
+    jz      .err_null_ptr
+    test    rcx, rcx
+    jz      .err_null_ptr
+
+    mov     eax, [rdi + BIGNUM_LEN_OFFSET]
+    test    eax, eax
+    js      .err_bad_length
+    cmp     eax, BIGNUM_CAPACITY
+    jg      .err_bad_length
+    lea     rax, [rdi + rax * 8]
+    mov     [rsp + F_END], rax
+
+    xor     eax, eax
+.zero_scan:
+    cmp     rax, rdx
+    je      .scan_done
+    cmp     qword [rsi + rax * 8], 0
+    je      .err_div_by_zero
+    inc     rax
+    jmp     .zero_scan
+.scan_done:
+
+    ; n = 0 делится на любое d
+    cmp     rdi, [rsp + F_END]
+    jne     .group_loop
+    mov     rdi, rcx
+    mov     rcx, rdx
+    mov     eax, 1
+    rep     stosb
+    jmp     .done
+
+    ; 2. Группы по DIVISIBLE_LANES делителей
+.group_loop:
+    mov     rax, [rsp + F_K]
+    test    rax, rax
+    jz      .done
+    mov     edx, DIVISIBLE_LANES
+    cmp     rax, rdx
+    cmovb   rdx, rax
+    mov     [rsp + F_G], rdx
+
+    LANE_SETUP 0, rbx, r12
+    LANE_SETUP 1, rbp, r13
+    LANE_SETUP 2, r14, rsi
+    LANE_SETUP 3, r15, rdi
+
+    ; 3. Цепочки по всем словам n
+    xor     r8d, r8d
+    xor     r9d, r9d
+    xor     r10d, r10d
+    xor     r11d, r11d
+    mov     rcx, [rsp + F_N]
+.word_loop:
+    LANE_STEP r8, rbx, r12
+    LANE_STEP r9, rbp, r13
+    LANE_STEP r10, r14, rsi
+    LANE_STEP r11, r15, rdi
+    add     rcx, 8
+    cmp     rcx, [rsp + F_END]
+    jne     .word_loop
+
+    LANE_FINISH 0, r8, r12
+    LANE_FINISH 1, r9, r13
+    LANE_FINISH 2, r10, rsi
+    LANE_FINISH 3, r11, rdi
+
+    mov     rdx, [rsp + F_G]
+    lea     rax, [rdx * 8]
+    add     [rsp + F_D], rax
+    add     [rsp + F_OUT], rdx
+    sub     [rsp + F_K], rdx
+    jmp     .group_loop
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+
+.exit:
+    ; --- Эпилог ---
+    add     rsp, F_SIZE
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
@@ -0,0 +1,421 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_mod_u64.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Остаток от деления большого числа на uint64_t без вычисления частного.
+;
+; @details
+;   Реализует функции bignum_mod_u64_ctx_init, bignum_mod_u64_pre и
+;   bignum_mod_u64 на ассемблере x86-64 (синтаксис YASM) в соответствии с
+;   System V AMD64 ABI.
+;
+;   В bignum_mod_u64_pre остаток вычисляется как сумма n->words[i] * (2^(64*i) mod d) по двум
+;   независимым 192-битным аккумуляторам. Произведения не зависят друг от
+;   друга, поэтому цикл ограничен пропускной способностью умножителя,
+;   а не задержкой цепочки остатков. Сумма приводится по модулю d тремя
+;   шагами DIV_2BY1_PREINV.
+;
+;   В bignum_mod_u64 делители 2^64 - 1 и 2^64 + 1 (3, 5, 17, 257, 641,
+;   65537, 274177, ...) распознаются одним шагом DIV_2BY1_PREINV: для них
+;   2^64 = 1 или -1 (mod d), и остаток получается из сумм чётных и нечётных
+;   слов n без цепочки.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+;   - rev. 2 (16.10.2026): Сумма слов в bignum_mod_u64 для делителей 2^64 +- 1.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+%define LIMB_SUM_MIN_LEN    8   ; с этой длины n проверяется 2^64 = +-1 (mod d)
+
+; =============================================================================
+; @brief  Заполняет таблицу степеней pow[i] = 2^(64*i) mod d.
+;
+; @details
+;   Степени считаются в нормализованном виде R_i = pow[i] << shift, так что
+;   R_(i+1) = (R_i : 0) mod dnorm — один шаг DIV_2BY1_PREINV на степень.
+;
+; @param  r8   [in] указатель на pow[0]
+; @param  r9   [in] число степеней (>= 1)
+; @param  rsi  [in] dnorm
+; @param  rbx  [in] v
+; @param  rcx  [in] shift
+; @clobbers rax, rdx, rdi, r8–r11, flags
+; =============================================================================
+%macro FILL_POWERS 0
+    mov     r10d, 1
+    shl     r10, cl                 ; R_0 = 1 << shift
+    xor     r11d, r11d
+    cmp     r10, rsi
+    cmove   r10, r11                ; d == 1: 2^0 mod 1 = 0
+%%power_loop:
+    mov     rax, r10
+    shr     rax, cl
+    mov     [r8], rax
+    DIV_2BY1_PREINV rdi, r10, r11, rsi, rbx
+    add     r8, 8
+    dec     r9
+    jnz     %%power_loop
+%endmacro
+
+; =============================================================================
+; @brief  Суммирует n->words[i] * pow[i] и приводит сумму по модулю d.
+;
+; @details
+;   Два аккумулятора (r11:r10:r8 и rbp:rcx:rbx) обрабатывают чётные и
+;   нечётные слова. Сумма 32 произведений меньше 2^133 и помещается в три
+;   слова; она сдвигается на shift и делится тремя шагами DIV_2BY1_PREINV.
+;
+; @param  rsi  [in]  n->words
+; @param  r9   [in]  n->len (>= 1)
+; @param  r14  [in]  указатель на bignum_mod_u64_ctx_t
+; @return r12 = остаток
+; @clobbers rax, rbx, rcx, rdx, rbp, rdi, r8–r11, r15, flags
+; =============================================================================
+%macro MOD_POWER_SUM 0
+    lea     rdi, [r14 + MCTX_POW_OFFSET]
+    xor     r8d, r8d
+    xor     r10d, r10d
+    xor     r11d, r11d
+    xor     ebx, ebx
+    xor     ecx, ecx
+    xor     ebp, ebp
+
+    test    r9, 1
+    jz      %%pairs
+    dec     r9
+    mov     rax, [rsi + r9 * 8]
+    mul     qword [rdi + r9 * 8]
+    mov     r8, rax
+    mov     r10, rdx
+%%pairs:
+    test    r9, r9
+    jz      %%sum_done
+%%sum_loop:
+    mov     rax, [rsi + r9 * 8 - 8]
+    mul     qword [rdi + r9 * 8 - 8]
+    add     r8, rax
+    adc     r10, rdx
+    adc     r11, 0
+    mov     rax, [rsi + r9 * 8 - 16]
+    mul     qword [rdi + r9 * 8 - 16]
+    add     rbx, rax
+    adc     rcx, rdx
+    adc     rbp, 0
+    sub     r9, 2
+    jnz     %%sum_loop
+%%sum_done:
+    add     r8, rbx
+    adc     r10, rcx
+    adc     r11, rbp
+
+    ; Приведение (r11:r10:r8) по модулю d
+    mov     r15, [r14 + CTX_DNORM_OFFSET]
+    mov     rbx, [r14 + CTX_V_OFFSET]
+    mov     rcx, [r14 + CTX_SHIFT_OFFSET]
+    xor     r12d, r12d
+    shld    r12, r11, cl
+    shld    r11, r10, cl
+    shld    r10, r8, cl
+    shl     r8, cl
+    DIV_2BY1_PREINV rbp, r12, r11, r15, rbx
+    DIV_2BY1_PREINV rbp, r12, r10, r15, rbx
+    DIV_2BY1_PREINV rbp, r12, r8, r15, rbx
+    shr     r12, cl
+%endmacro
+
+section .text
+
+; =============================================================================
+; @brief      Подготавливает контекст делителя для bignum_mod_u64_pre.
+;
+; @abi        System V AMD64 ABI
+; @param[in]  rdi: bignum_mod_u64_ctx_t *ctx (Указатель на контекст)
+; @param[in]  rsi: uint64_t d                (64-битный делитель)
+;
+; @return     rax: bignum_div_u64_status_t (0, -1, -2)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_mod_u64_ctx_init
+
+bignum_mod_u64_ctx_init:
+    test    rdi, rdi
+    jz      .err_null_ptr
+    test    rsi, rsi
+    jz      .err_div_by_zero
+
+    push    rbx
+    mov     [rdi + CTX_D_OFFSET], rsi
+    PREINV_SETUP rsi, rbx
+    mov     [rdi + CTX_DNORM_OFFSET], rsi
+    mov     [rdi + CTX_V_OFFSET], rbx
+    mov     [rdi + CTX_SHIFT_OFFSET], rcx
+
+    lea     r8, [rdi + MCTX_POW_OFFSET]
+    mov     r9d, BIGNUM_CAPACITY
+    FILL_POWERS
+    pop     rbx
+
+    mov     eax, BIGNUM_DIV_U64_OK
+    ret
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    ret
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    ret
+
+; =============================================================================
+; @brief      Вычисляет остаток n mod d по предвычисленному контексту.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n                (Указатель на делимое)
+;   - `rsi`: const bignum_mod_u64_ctx_t *ctx  (Указатель на контекст делителя)
+;   - `rdx`: uint64_t *rem                    (Указатель на 64-битный остаток)
+;   - `rax`: bignum_div_u64_status_t          (Возвращаемый код состояния)
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_mod_u64_pre
+
+bignum_mod_u64_pre:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+
+    mov     r13, rdx    ; rem
+    mov     r14, rsi    ; ctx
+    mov     rsi, rdi    ; n
+
+    ; 1. Валидация входных данных
+    test    rsi, rsi
+    jz      .err_null_ptr
+    test    r14, r14
+    jz      .err_null_ptr
+    test    r13, r13
+    jz      .err_null_ptr
+
+    mov     r9d, [rsi + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    cmp     qword [r14 + CTX_D_OFFSET], 0
+    je      .err_div_by_zero
+
+    ; 2. Тривиальный случай n->len == 0
+    mov     qword [r13], 0
+    test    r9, r9
+    jz      .done
+
+    ; 3. Сумма произведений и приведение
+    MOD_POWER_SUM
+    mov     [r13], r12
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.exit:
+    ; --- Эпилог ---
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
+
+; =============================================================================
+; @brief      Вычисляет остаток n mod d.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n  (Указатель на делимое)
+;   - `rsi`: uint64_t d         (64-битный делитель)
+;   - `rdx`: uint64_t *rem      (Указатель на 64-битный остаток)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   Для разового делителя таблица степеней не окупается: её построение —
+;   такая же последовательная цепочка длины n->len. Поэтому вычисляется
+;   обратная величина (один `div`) и выполняется цепочка шагов
+;   DIV_2BY1_PREINV без записи частного, обнуления хвоста и нормализации.
+;
+;   С LIMB_SUM_MIN_LEN слов шаг DIV_2BY1_PREINV даёт (2^64 - 1) mod d. Если
+;   это 0 (d | 2^64 - 1) или d - 2 (d | 2^64 + 1), то 2^64 = s (mod d),
+;   s = +-1, и при суммах E и O чётных и нечётных слов n = E + s * O. Суммы
+;   точные (два слова, цепочки `add`/`adc` не зависят от d), а остаток от
+;   t = E + O или t = E_lo + O_hi + (E_hi + O_lo) * 2^64 (так как
+;   -1 = 2^64) — три шага DIV_2BY1_PREINV.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_mod_u64
+
+bignum_mod_u64:
+    ; --- Пролог ---
+    push    rbx
+    push    r12
+    push    r13
+    push    r14
+
+    mov     r13, rdx    ; rem
+    mov     r12, rdi    ; n
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      .err_null_ptr
+    test    r13, r13
+    jz      .err_null_ptr
+
+    mov     r9d, [r12 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    test    rsi, rsi
+    jz      .err_div_by_zero
+
+    ; 2. Тривиальный случай n->len == 0
+    mov     qword [r13], 0
+    test    r9, r9
+    jz      .done
+
+    ; 3. Обратная величина; 2^64 = +-1 (mod d)?
+    PREINV_SETUP rsi, rbx                   ; rsi = dnorm, rbx = v, rcx = shift
+    mov     r14, rsi
+    cmp     r9, LIMB_SUM_MIN_LEN
+    jb      .chain
+    bt      r14, rcx
+    jnc     .chain                          ; чётный d не делит 2^64 +- 1
+    xor     r8d, r8d
+    mov     rsi, -1
+    shld    r8, rsi, cl
+    shl     rsi, cl
+    DIV_2BY1_PREINV r10, r8, rsi, r14, rbx  ; r8 = ((2^64 - 1) mod d) << shift
+    xor     r11d, r11d                      ; s = +1
+    test    r8, r8
+    jz      .limb_sum
+    mov     eax, 2
+    shl     rax, cl
+    add     rax, r8
+    cmp     rax, r14
+    jne     .chain
+    dec     r11                             ; s = -1: d | 2^64 + 1
+
+    ; 4. Суммы чётных (r10:r8) и нечётных (rdi:rsi) слов
+.limb_sum:
+    xor     r8d, r8d
+    xor     r10d, r10d
+    xor     esi, esi
+    xor     edi, edi
+    test    r9, 1
+    jz      .sum_loop
+    dec     r9
+    mov     r8, [r12 + r9 * 8]              ; старшее слово нечётной длины — чётное
+.sum_loop:
+    add     r8, [r12]
+    adc     r10, 0
+    add     rsi, [r12 + 8]
+    adc     rdi, 0
+    add     r12, 16
+    sub     r9, 2
+    jnz     .sum_loop
+    test    r11, r11
+    jz      .sum_join
+    xchg    rsi, rdi                        ; s = -1: O_hi к младшему слову
+.sum_join:
+    add     r8, rsi
+    adc     r10, rdi
+    setc    r9b                             ; t = (r9:r10:r8)
+
+    ; 5. t mod d
+    mov     rdi, r8
+    mov     rsi, r10
+    xor     r8d, r8d
+    shld    r8, r9, cl
+    shld    r9, rsi, cl
+    DIV_2BY1_PREINV r10, r8, r9, r14, rbx
+    shld    rsi, rdi, cl
+    DIV_2BY1_PREINV r10, r8, rsi, r14, rbx
+    shl     rdi, cl
+    DIV_2BY1_PREINV r10, r8, rdi, r14, rbx
+    shr     r8, cl
+    mov     [r13], r8
+    jmp     .done
+
+    ; 6. Цепочка шагов DIV_2BY1_PREINV без записи частного
+.chain:
+    mov     rsi, [r12 + r9 * 8 - 8]
+    xor     r8d, r8d
+    shld    r8, rsi, cl
+    dec     r9
+    jz      .last_word
+.chain_loop:
+    mov     rdi, [r12 + r9 * 8 - 8]
+    shld    rsi, rdi, cl
+    DIV_2BY1_PREINV r10, r8, rsi, r14, rbx
+    mov     rsi, rdi
+    dec     r9
+    jnz     .chain_loop
+.last_word:
+    shl     rsi, cl
+    DIV_2BY1_PREINV r10, r8, rsi, r14, rbx
+    shr     r8, cl
+    mov     [r13], r8
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.exit:
+    ; --- Эпилог ---
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbx
+    ret
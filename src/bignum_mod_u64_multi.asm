@@ -0,0 +1,403 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_mod_u64_multi.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    15.10.2026
+;
+; @brief   Остатки одного большого числа по многим 64-битным делителям за один проход.
+;
+; @details
+;   Реализует функции bignum_mod_u64_multi и bignum_mod_u64_multi_limbs на
+;   ассемблере x86-64 (синтаксис YASM) в соответствии с System V AMD64 ABI.
+;   Вторая принимает массив слов любой длины и входит в общий проход
+;   после своей валидации. Каждое слово делимого
+;   читается один раз на группу из MULTI_CHUNK делителей, и по нему
+;   продвигаются все независимые цепочки остатков группы.
+;
+;   Делители < MULTI_SIMD_DMAX обрабатываются парами в SSE2-полосах
+;   (double): при d < 2^21 промежуточное x = r * 2^32 + h < 2^53 точно
+;   представимо, частное округляется к ближайшему, а остаток исправляется
+;   одним сравнением. Остальные делители идут по скалярной цепочке
+;   DIV_2BY1_PREINV. SSE2 входит в базовый x86-64, проверка CPUID не нужна.
+;
+; @history
+;   - rev. 1 (15.10.2026): Первоначальная реализация.
+;   - rev. 2 (16.10.2026): Точка входа bignum_mod_u64_multi_limbs (массив слов).
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+%define MULTI_CHUNK      32             ; делителей на один проход по n
+%define MULTI_SIMD_DMAX  (1 << 21)      ; граница точности SSE2-полос
+
+; --- Скалярная полоса ---
+%define S_DN        0
+%define S_V         8
+%define S_SHIFT     16
+%define S_R         24
+%define S_REM       32                  ; &rem[j]
+%define S_SIZE      40
+
+; --- Пара SSE2-полос ---
+%define P_D         0                   ; double d[2]
+%define P_DINV      16                  ; double 1/d[2]
+%define P_R         32                  ; double r[2]
+%define P_REM       48                  ; &rem[j0], &rem[j1]
+%define P_SIZE      64
+
+; --- Кадр стека ---
+%define F_N         0                   ; слова делимого
+%define F_D         8
+%define F_K         16
+%define F_REM       24
+%define F_BASE      32
+%define F_CNT       40
+%define F_S_END     48
+%define F_P_END     56
+%define F_SCRATCH   64                  ; остаток фиктивной полосы
+%define F_LEN       72                  ; длина делимого в словах
+%define F_SCALAR    80
+%define F_PAIRS     (F_SCALAR + MULTI_CHUNK * S_SIZE)
+%define FRAME_SIZE  (F_PAIRS + (MULTI_CHUNK / 2) * P_SIZE)
+
+; =============================================================================
+; @brief  Шаг r = (r * 2^32 + h) mod d в двух SSE2-полосах.
+;
+; @param  %1    [in]     h, 32-битная часть слова в обеих полосах (xmm)
+; @param  xmm5  [in/out] r
+; @param  xmm6  [in]     d
+; @param  xmm7  [in]     1/d
+; @param  xmm2, xmm3, xmm4  2^32, 2^52, 0.0
+; @clobbers xmm8
+; =============================================================================
+%macro SIMD_MOD_STEP 1
+    mulpd   xmm5, xmm2
+    addpd   xmm5, %1                ; x = r * 2^32 + h, точно
+    movapd  xmm8, xmm5
+    mulpd   xmm8, xmm7
+    addpd   xmm8, xmm3
+    subpd   xmm8, xmm3              ; q = round(x / d), ошибка < 2^-20
+    mulpd   xmm8, xmm6
+    subpd   xmm5, xmm8              ; r = x - q * d, |r| < d
+    movapd  xmm8, xmm5
+    cmpltpd xmm8, xmm4
+    andpd   xmm8, xmm6
+    addpd   xmm5, xmm8              ; r < 0: r += d
+%endmacro
+
+section .rodata
+align 8
+multi_one:      dq 0x3FF0000000000000   ; 1.0
+multi_two32:    dq 0x41F0000000000000   ; 2^32
+multi_magic:    dq 0x4330000000000000   ; 2^52
+
+section .text
+
+; =============================================================================
+; @brief      Вычисляет rem[j] = n mod d[j] для j = 0..k-1.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n  (Указатель на делимое)
+;   - `rsi`: const uint64_t *d  (Массив из k делителей)
+;   - `rdx`: size_t k           (Число делителей)
+;   - `rcx`: uint64_t *rem      (Массив из k остатков)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** указатели, длина `n`, все делители (до любой записи).
+;   2.  **Группы:** делители берутся группами по MULTI_CHUNK. Для каждой
+;       группы на стеке строятся скалярные полосы (dnorm, v, shift) и
+;       пары SSE2-полос (d, 1/d).
+;   3.  **Проход по n:** для i = n->len .. 0 слово читается один раз;
+;       скалярные полосы делают шаг над shld(n[i], n[i-1]) (виртуальное
+;       слово i = n->len даёт начальный остаток), SSE2-полосы — два шага
+;       по 32-битным половинам n[i].
+;   4.  **Запись:** скалярные остатки денормализуются, SSE2-остатки
+;       переводятся в целые.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11, xmm0–xmm8
+; =============================================================================
+align 16
+global bignum_mod_u64_multi
+
+bignum_mod_u64_multi:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, FRAME_SIZE
+
+    ; 1. Валидация входных данных
+    test    rdi, rdi
+    jz      .err_null_ptr
+    test    rsi, rsi
+    jz      .err_null_ptr
+    test    rcx, rcx
+    jz      .err_null_ptr
+
+    mov     eax, [rdi + BIGNUM_LEN_OFFSET]
+    test    eax, eax
+    js      .err_bad_length
+    cmp     eax, BIGNUM_CAPACITY
+    jg      .err_bad_length
+    mov     [rsp + F_LEN], rax
+
+.check_divisors:
+    xor     r9d, r9d
+.validate_loop:
+    cmp     r9, rdx
+    jae     .validated
+    cmp     qword [rsi + r9 * 8], 0
+    je      .err_div_by_zero
+    inc     r9
+    jmp     .validate_loop
+
+.validated:
+    mov     [rsp + F_N], rdi
+    mov     [rsp + F_D], rsi
+    mov     [rsp + F_K], rdx
+    mov     [rsp + F_REM], rcx
+    xor     eax, eax
+
+    ; 2. Группы делителей
+.chunk_loop:
+    cmp     rax, [rsp + F_K]
+    jae     .done
+    mov     [rsp + F_BASE], rax
+    mov     rbp, [rsp + F_K]
+    sub     rbp, rax
+    mov     ecx, MULTI_CHUNK
+    cmp     rbp, rcx
+    cmova   rbp, rcx
+    mov     [rsp + F_CNT], rbp
+
+    lea     r12, [rsp + F_SCALAR]           ; следующая скалярная полоса
+    lea     r13, [rsp + F_PAIRS]            ; следующая пара SSE2-полос
+    xor     r15d, r15d                      ; занятая половина пары (0/1)
+    mov     r14, [rsp + F_D]
+    lea     r14, [r14 + rax * 8]            ; &d[base]
+    mov     rbx, [rsp + F_REM]
+    lea     rbx, [rbx + rax * 8]            ; &rem[base]
+
+.setup_loop:
+    mov     rsi, [r14]
+    cmp     rsi, MULTI_SIMD_DMAX
+    jae     .setup_scalar
+    cvtsi2sd xmm0, rsi
+    movsd   xmm1, [rel multi_one]
+    divsd   xmm1, xmm0
+    movsd   [r13 + r15 * 8 + P_D], xmm0
+    movsd   [r13 + r15 * 8 + P_DINV], xmm1
+    mov     qword [r13 + r15 * 8 + P_R], 0
+    mov     [r13 + r15 * 8 + P_REM], rbx
+    xor     r15d, 1
+    jnz     .setup_next
+    add     r13, P_SIZE                     ; пара заполнена
+    jmp     .setup_next
+.setup_scalar:
+    PREINV_SETUP rsi, rdi
+    mov     [r12 + S_DN], rsi
+    mov     [r12 + S_V], rdi
+    mov     [r12 + S_SHIFT], rcx
+    mov     qword [r12 + S_R], 0
+    mov     [r12 + S_REM], rbx
+    add     r12, S_SIZE
+.setup_next:
+    add     r14, 8
+    add     rbx, 8
+    dec     rbp
+    jnz     .setup_loop
+
+    ; Незаполненная половина пары: фиктивный делитель 1
+    test    r15, r15
+    jz      .setup_done
+    movsd   xmm0, [rel multi_one]
+    movsd   [r13 + 8 + P_D], xmm0
+    movsd   [r13 + 8 + P_DINV], xmm0
+    mov     qword [r13 + 8 + P_R], 0
+    lea     rax, [rsp + F_SCRATCH]
+    mov     [r13 + 8 + P_REM], rax
+    add     r13, P_SIZE
+.setup_done:
+    mov     [rsp + F_S_END], r12
+    mov     [rsp + F_P_END], r13
+
+    ; 3. Один проход по словам n
+    movsd   xmm2, [rel multi_two32]
+    unpcklpd xmm2, xmm2
+    movsd   xmm3, [rel multi_magic]
+    unpcklpd xmm3, xmm3
+    xorpd   xmm4, xmm4
+    mov     r12, [rsp + F_N]
+    mov     r13, [rsp + F_LEN]              ; i = len (виртуальное слово)
+
+.limb_loop:
+    xor     esi, esi
+    cmp     r13, [rsp + F_LEN]
+    jae     .cur_ready
+    mov     rsi, [r12 + r13 * 8]            ; cur = n[i]
+.cur_ready:
+    xor     edi, edi
+    test    r13, r13
+    jz      .next_ready
+    mov     rdi, [r12 + r13 * 8 - 8]        ; next = n[i - 1]
+.next_ready:
+
+    ; Скалярные полосы
+    lea     r9, [rsp + F_SCALAR]
+    mov     r10, [rsp + F_S_END]
+    cmp     r9, r10
+    jae     .scalar_done
+.scalar_loop:
+    mov     rcx, [r9 + S_SHIFT]
+    mov     r11, rsi
+    shld    r11, rdi, cl
+    mov     r8, [r9 + S_R]
+    mov     r14, [r9 + S_DN]
+    mov     rbx, [r9 + S_V]
+    DIV_2BY1_PREINV rbp, r8, r11, r14, rbx
+    mov     [r9 + S_R], r8
+    add     r9, S_SIZE
+    cmp     r9, r10
+    jb      .scalar_loop
+.scalar_done:
+
+    ; SSE2-полосы: старшая, затем младшая половина слова
+    lea     r9, [rsp + F_PAIRS]
+    mov     r10, [rsp + F_P_END]
+    cmp     r9, r10
+    jae     .pairs_done
+    mov     rax, rsi
+    shr     rax, 32
+    cvtsi2sd xmm0, rax
+    unpcklpd xmm0, xmm0
+    mov     eax, esi
+    cvtsi2sd xmm1, rax
+    unpcklpd xmm1, xmm1
+.pair_loop:
+    movupd  xmm5, [r9 + P_R]
+    movupd  xmm6, [r9 + P_D]
+    movupd  xmm7, [r9 + P_DINV]
+    SIMD_MOD_STEP xmm0
+    SIMD_MOD_STEP xmm1
+    movupd  [r9 + P_R], xmm5
+    add     r9, P_SIZE
+    cmp     r9, r10
+    jb      .pair_loop
+.pairs_done:
+    sub     r13, 1
+    jnc     .limb_loop
+
+    ; 4. Запись остатков группы
+    lea     r9, [rsp + F_SCALAR]
+    mov     r10, [rsp + F_S_END]
+    cmp     r9, r10
+    jae     .store_pairs
+.store_scalar:
+    mov     rcx, [r9 + S_SHIFT]
+    mov     rax, [r9 + S_R]
+    shr     rax, cl
+    mov     rdx, [r9 + S_REM]
+    mov     [rdx], rax
+    add     r9, S_SIZE
+    cmp     r9, r10
+    jb      .store_scalar
+.store_pairs:
+    lea     r9, [rsp + F_PAIRS]
+    mov     r10, [rsp + F_P_END]
+    cmp     r9, r10
+    jae     .chunk_done
+.store_pair_loop:
+    cvttsd2si rax, [r9 + P_R]
+    mov     rdx, [r9 + P_REM]
+    mov     [rdx], rax
+    cvttsd2si rax, [r9 + P_R + 8]
+    mov     rdx, [r9 + P_REM + 8]
+    mov     [rdx], rax
+    add     r9, P_SIZE
+    cmp     r9, r10
+    jb      .store_pair_loop
+.chunk_done:
+    mov     rax, [rsp + F_BASE]
+    add     rax, [rsp + F_CNT]
+    jmp     .chunk_loop
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.exit:
+    ; --- Эпилог ---
+    add     rsp, FRAME_SIZE
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
+
+; =============================================================================
+; @brief      Вычисляет rem[j] = n mod d[j] для делимого из len слов.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const uint64_t *n  (Слова делимого, младшее первым)
+;   - `rsi`: size_t len         (Число слов; при len == 0 n может быть NULL)
+;   - `rdx`: const uint64_t *d  (Массив из k делителей)
+;   - `rcx`: size_t k           (Число делителей)
+;   - `r8`:  uint64_t *rem      (Массив из k остатков)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   Проверяет указатели, раскладывает аргументы как у bignum_mod_u64_multi
+;   и продолжает с проверки делителей; дальше проход общий.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11, xmm0–xmm8
+; =============================================================================
+align 16
+global bignum_mod_u64_multi_limbs
+
+bignum_mod_u64_multi_limbs:
+    ; --- Пролог (кадр bignum_mod_u64_multi) ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, FRAME_SIZE
+
+    test    rdx, rdx
+    jz      bignum_mod_u64_multi.err_null_ptr
+    test    r8, r8
+    jz      bignum_mod_u64_multi.err_null_ptr
+    test    rsi, rsi
+    jz      .args
+    test    rdi, rdi
+    jz      bignum_mod_u64_multi.err_null_ptr
+.args:
+    mov     [rsp + F_LEN], rsi
+    mov     rsi, rdx
+    mov     rdx, rcx
+    mov     rcx, r8
+    jmp     bignum_mod_u64_multi.check_divisors
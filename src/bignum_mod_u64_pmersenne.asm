@@ -0,0 +1,359 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_mod_u64_pmersenne.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    16.10.2026
+;
+; @brief   Остаток по модулям специального вида 2^64 - c и 2^k - 1 без `div`.
+;
+; @details
+;   Реализует функции bignum_mod_u64_pmersenne и bignum_mod_u64_mersenne на
+;   ассемблере x86-64 (синтаксис YASM) в соответствии с System V AMD64 ABI.
+;
+;   Для обоих видов модуля p выполняется 2^64 = c (mod p) с малым c < 2^32:
+;   c для p = 2^64 - c и c = 2^(64 mod k) для p = 2^k - 1. Тогда шаг Горнера
+;   r * 2^64 + w сводится к r * c + w, а старшее слово произведения снова
+;   складывается с множителем c — два умножения и ни одного деления.
+;   Промежуточный r — любое 64-битное число, сравнимое с остатком; приведение
+;   в [0, p) выполняется один раз в конце.
+;
+;   Шаги одной цепочки зависят друг от друга, поэтому с PM_CHAIN_MIN слов
+;   n делится на четыре четверти, которые сворачиваются независимыми
+;   цепочками вместе с пятой — K = 2^(64m) mod p, — и собирается в конце
+;   тремя шагами по K.
+;
+; @history
+;   - rev. 1 (16.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+%define PM_CHAIN_MIN    8       ; с этой длины n — четыре цепочки
+
+; =============================================================================
+; @brief  Шаг свёртки: acc = acc * c + w (mod p), acc < 2^64.
+;
+; @details
+;   acc * c + w = h * 2^64 + l, h <= c; h * 2^64 = h * c, и h * c <= c^2.
+;   Перенос из l + h * c снова равен c; после него сумма меньше c^2 + c и
+;   не переполняется (c < 2^32).
+;
+; @param  %1   [in/out] acc
+; @param  %2   [in]     слово w (память или регистр)
+; @param  r15  [in]     c
+; @clobbers rax, rdx, flags
+; =============================================================================
+%macro FOLD_STEP 2
+    mov     rax, %1
+    mul     r15
+    add     rax, %2
+    adc     rdx, 0                      ; h <= c
+    imul    rdx, r15
+    add     rax, rdx
+    lea     %1, [rax + r15]             ; перенос 2^64 = c
+    cmovnc  %1, rax
+%endmacro
+
+; -----------------------------------------------------------------------------
+; FOLD_STEP без слова: %1 = %1 * c (mod p). @clobbers rax, rdx, flags
+; -----------------------------------------------------------------------------
+%macro POWER_STEP 1
+    mov     rax, %1
+    mul     r15
+    imul    rdx, r15
+    add     rax, rdx
+    lea     %1, [rax + r15]
+    cmovnc  %1, rax
+%endmacro
+
+; =============================================================================
+; @brief  Сворачивает 128-битное rdx:rax в 64-битное rax, сравнимое по модулю p.
+;
+; @param  r15  [in] c
+; @clobbers rdx, rbp, flags
+; =============================================================================
+%macro REDUCE_128 0
+    mov     rbp, rax
+    mov     rax, rdx
+    mul     r15                         ; старшее слово * c, старшая часть < c
+    add     rax, rbp
+    adc     rdx, 0
+    imul    rdx, r15
+    add     rax, rdx
+    lea     rdx, [rax + r15]
+    cmovc   rax, rdx
+%endmacro
+
+; =============================================================================
+; @brief  Сворачивает n->words в 64-битное r, сравнимое с n по модулю p.
+;
+; @details
+;   1.  **Короткое n** (len < PM_CHAIN_MIN): одна цепочка FOLD_STEP от
+;       старшего слова.
+;   2.  **Четыре цепочки:** m = floor(len / 4),
+;       n = A * 2^(192m) + B * 2^(128m) + D * 2^(64m) + E; старшие len mod 4
+;       слов сворачиваются в A до цикла. Пятая цепочка считает
+;       K = c^m = 2^(64m) (mod p).
+;   3.  **Сборка:** r = ((A * K + B) * K + D) * K + E, каждое звено —
+;       REDUCE_128.
+;
+; @param  r12  [in] n->words
+; @param  r9   [in] n->len
+; @param  r15  [in] c (1 <= c < 2^32)
+; @return r8 = r
+; @clobbers rax, rbx, rcx, rdx, rbp, rsi, rdi, r9–r11, r13, r14, flags
+; =============================================================================
+%macro PM_FOLD_CORE 0
+    xor     r8d, r8d
+    cmp     r9, PM_CHAIN_MIN
+    jae     %%chains
+
+    ; 1. Одна цепочка
+    test    r9, r9
+    jz      %%done
+%%serial:
+    FOLD_STEP r8, [r12 + r9 * 8 - 8]
+    dec     r9
+    jnz     %%serial
+    jmp     %%done
+
+    ; 2. Четыре цепочки по четвертям и цепочка K
+%%chains:
+    mov     rcx, r9
+    shr     rcx, 2                      ; m
+    lea     rdi, [rcx * 8]              ; 8m
+    lea     rbx, [rdi + rdi * 2]        ; 24m
+    lea     rsi, [rcx * 4]              ; 4m
+    jmp     %%top_check
+%%top:
+    FOLD_STEP r8, [r12 + r9 * 8 - 8]    ; старшие len mod 4 слов -> A
+    dec     r9
+%%top_check:
+    cmp     r9, rsi
+    ja      %%top
+
+    xor     r10d, r10d                  ; B
+    xor     r11d, r11d                  ; D
+    xor     r13d, r13d                  ; E
+    mov     r14d, 1                     ; K
+    lea     rsi, [r12 + rcx * 8 - 8]    ; слово m - 1 четверти E
+%%loop:
+    FOLD_STEP r8, [rsi + rbx]
+    FOLD_STEP r10, [rsi + rdi * 2]
+    FOLD_STEP r11, [rsi + rdi]
+    FOLD_STEP r13, [rsi]
+    POWER_STEP r14
+    sub     rsi, 8
+    dec     rcx
+    jnz     %%loop
+
+    ; 3. r = ((A * K + B) * K + D) * K + E
+    mov     rax, r8
+    mul     r14
+    add     rax, r10
+    adc     rdx, 0
+    REDUCE_128
+    mul     r14
+    add     rax, r11
+    adc     rdx, 0
+    REDUCE_128
+    mul     r14
+    add     rax, r13
+    adc     rdx, 0
+    REDUCE_128
+    mov     r8, rax
+%%done:
+%endmacro
+
+section .text
+
+; =============================================================================
+; @brief      Вычисляет остаток n mod (2^64 - c).
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n       (Указатель на структуру делимого)
+;   - `rsi`: uint64_t c              (Модуль p = 2^64 - c, 1 <= c < 2^32)
+;   - `rdx`: uint64_t *rem           (Указатель на остаток)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   Валидация — как в bignum_mod_u64, затем проверка c. После PM_FOLD_CORE
+;   r < 2^64 < 2p, и r >= p видно по переносу r + c.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -4, -5)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_mod_u64_pmersenne
+
+bignum_mod_u64_pmersenne:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    push    rdx         ; rem
+
+    mov     r12, rdi    ; n
+    mov     r15, rsi    ; c
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      .err_null_ptr
+    test    rdx, rdx
+    jz      .err_null_ptr
+
+    mov     r9d, [r12 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    test    r15, r15
+    jz      .err_unsupported
+    mov     rax, r15
+    shr     rax, 32
+    jnz     .err_unsupported
+
+    ; 2. Свёртка и приведение в [0, p)
+    PM_FOLD_CORE
+    mov     rax, r8
+    add     rax, r15
+    cmovnc  rax, r8                     ; r >= p -> r - p = r + c - 2^64
+    mov     rdx, [rsp]
+    mov     [rdx], rax
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_unsupported:
+    mov     eax, BIGNUM_DIV_U64_ERR_UNSUPPORTED
+
+.exit:
+    ; --- Эпилог ---
+    pop     rdx
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
+
+; =============================================================================
+; @brief      Вычисляет остаток n mod (2^k - 1).
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n       (Указатель на структуру делимого)
+;   - `esi`: unsigned k              (Модуль p = 2^k - 1, 2 <= k <= 64)
+;   - `rdx`: uint64_t *rem           (Указатель на остаток)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** как в bignum_mod_u64_pmersenne, затем проверка k.
+;   2.  **Свёртка:** c = 2^(64 mod k) < 2^32, PM_FOLD_CORE.
+;   3.  **Приведение:** пока r > p, r = (r & p) + (r >> k); затем r == p
+;       даёт 0. При k = 64 цикл не выполняется.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -4, -5)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_mod_u64_mersenne
+
+bignum_mod_u64_mersenne:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    push    rdx         ; rem
+    push    rsi         ; k
+
+    mov     r12, rdi    ; n
+
+    ; 1. Валидация входных данных
+    test    r12, r12
+    jz      .err_null_ptr
+    test    rdx, rdx
+    jz      .err_null_ptr
+
+    mov     r9d, [r12 + BIGNUM_LEN_OFFSET]
+    test    r9d, r9d
+    js      .err_bad_length
+    cmp     r9d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    lea     eax, [rsi - 2]
+    cmp     eax, 62
+    ja      .err_unsupported            ; k < 2 или k > 64
+
+    ; 2. c = 2^(64 mod k)
+    mov     eax, 64
+    xor     edx, edx
+    div     esi
+    mov     ecx, edx
+    mov     r15d, 1
+    shl     r15, cl
+    PM_FOLD_CORE
+
+    ; 3. Приведение в [0, p)
+    mov     ecx, [rsp]
+    mov     rdx, -1
+    neg     ecx
+    add     ecx, 64
+    shr     rdx, cl                     ; p = 2^k - 1
+    mov     ecx, [rsp]
+.fold:
+    cmp     r8, rdx
+    jbe     .fold_done
+    mov     rax, r8
+    shr     rax, cl
+    and     r8, rdx
+    add     r8, rax
+    jmp     .fold
+.fold_done:
+    xor     eax, eax
+    cmp     r8, rdx
+    cmove   r8, rax                     ; r == p -> 0
+    mov     rdx, [rsp + 8]
+    mov     [rdx], r8
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_unsupported:
+    mov     eax, BIGNUM_DIV_U64_ERR_UNSUPPORTED
+
+.exit:
+    ; --- Эпилог ---
+    pop     rsi
+    pop     rdx
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
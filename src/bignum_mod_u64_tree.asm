@@ -0,0 +1,623 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_mod_u64_tree.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    16.10.2026
+;
+; @brief   Остатки длинного числа по тысячам 64-битных модулей деревом остатков.
+;
+; @details
+;   Реализует функцию bignum_mod_u64_tree на ассемблере x86-64 (синтаксис
+;   YASM) в соответствии с System V AMD64 ABI.
+;
+;   Модули обрабатываются блоками по TREE_BLOCK. Для блока строится дерево
+;   произведений: лист — модуль, узел уровня t — произведение 2^t соседних
+;   модулей (не более 2^t слов). Затем n один раз делится на корень, а
+;   остатки спускаются по дереву: остаток узла = остаток родителя mod
+;   произведение узла. Длинные операции — школьное умножение (tree_mul) и
+;   деление Кнута, алгоритм D (tree_mod): их внутренние циклы — цепочки
+;   mul/adc без зависимости по остатку, и на одну пару (слово n, модуль)
+;   приходится одно такое умножение вместо шага 2/1 с обратной величиной.
+;
+;   Это тот же порядок работы, что у одного прохода по n на группу модулей
+;   (bignum_mod_u64_multi_limbs); дерево выигрывает в константе, когда
+;   модули короче 64 бит или n длинное, поэтому блоки, где оно не быстрее,
+;   передаются одному проходу (TREE_ROUTE_BITS, TREE_ROUTE_COST).
+;
+;   Узлы одного уровня и разные блоки независимы.
+;
+; @history
+;   - rev. 1 (16.10.2026): Первоначальная реализация.
+;   - rev. 2 (16.10.2026): Блок идёт деревом, только если оно быстрее одного
+;                          прохода bignum_mod_u64_multi_limbs.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+extern bignum_mod_u64_multi_limbs
+
+; --- Раскладка рабочей памяти (слова) ---
+%define S_TREE     0                                    ; уровень t: TREE_BLOCK слов
+%define S_REM_A    (TREE_LEVELS * TREE_BLOCK)           ; остатки уровня
+%define S_REM_B    ((TREE_LEVELS + 1) * TREE_BLOCK)
+%define S_WORK     ((TREE_LEVELS + 2) * TREE_BLOCK)     ; нормализованные a, b для tree_mod
+
+; --- Кадр стека bignum_mod_u64_tree ---
+%define F_N        0
+%define F_LEN      8
+%define F_D        16
+%define F_K        24
+%define F_REM      32
+%define F_M        40                   ; модулей в блоке
+%define F_TOP      48                   ; уровень корня
+%define F_CUR      56                   ; остатки текущего уровня
+%define F_NEXT     64                   ; остатки следующего уровня
+%define F_LVL      72                   ; T[t][0] на спуске
+%define F_SIZE     88                   ; rsp кратен 16 после пролога
+
+; =============================================================================
+; @brief  %1 = длина без старших нулевых слов числа [%2], не больше %3, >= 1.
+;
+; @param  %1   [out] длина (регистр)
+; @param  %2   [in]  адрес младшего слова (регистр)
+; @param  %3   [in]  ёмкость слота (регистр или константа)
+; @clobbers flags
+; =============================================================================
+%macro TRIMMED_LEN 3
+    mov     %1, %3
+%%trim:
+    cmp     %1, 1
+    je      %%done
+    cmp     qword [%2 + %1 * 8 - 8], 0
+    jne     %%done
+    dec     %1
+    jmp     %%trim
+%%done:
+%endmacro
+
+section .text
+
+; =============================================================================
+; @brief  Школьное умножение: r[0..an+bn) = a[0..an) * b[0..bn).
+;
+; @param  rdi  [out] r (не пересекается с a и b)
+; @param  rsi  [in]  a, an >= 1
+; @param  rdx  [in]  an
+; @param  rcx  [in]  b, bn >= 1
+; @param  r8   [in]  bn
+; @clobbers rax, rcx, rdx, r8–r11, flags
+; =============================================================================
+align 16
+tree_mul:
+    push    rbx
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+
+    mov     r12, rdx                    ; an
+    mov     r13, r8                     ; bn
+    mov     rbx, rcx                    ; b
+
+    ; Строка 0: r[0..an] = a * b[0]
+    mov     r9, [rbx]
+    xor     r10d, r10d
+    xor     ecx, ecx
+.row0:
+    mov     rax, [rsi + rcx * 8]
+    mul     r9
+    add     rax, r10
+    adc     rdx, 0
+    mov     [rdi + rcx * 8], rax
+    mov     r10, rdx
+    inc     rcx
+    cmp     rcx, r12
+    jb      .row0
+    mov     [rdi + r12 * 8], r10
+
+    ; Строки j >= 1: r[j..j+an] += a * b[j]
+    mov     r14d, 1
+.rows:
+    cmp     r14, r13
+    jae     .done
+    mov     r9, [rbx + r14 * 8]
+    lea     r15, [rdi + r14 * 8]
+    xor     r10d, r10d
+    xor     ecx, ecx
+.row:
+    mov     rax, [rsi + rcx * 8]
+    mul     r9
+    add     rax, r10
+    adc     rdx, 0
+    add     [r15 + rcx * 8], rax
+    adc     rdx, 0
+    mov     r10, rdx
+    inc     rcx
+    cmp     rcx, r12
+    jb      .row
+    mov     [r15 + r12 * 8], r10
+    inc     r14
+    jmp     .rows
+
+.done:
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbx
+    ret
+
+; =============================================================================
+; @brief  Остаток: out[0..bn) = a[0..an) mod b[0..bn) (алгоритм D Кнута).
+;
+; @details
+;   a и b сдвигаются влево на число ведущих нулей b[bn-1] в work; каждое
+;   слово частного оценивается делением двух верхних слов окна на старшее
+;   слово b и уточняется по второму (не более двух поправок), после чего
+;   q * b вычитается из окна; редкий отрицательный результат исправляется
+;   обратным сложением. При bn == 1 — цепочка div.
+;
+; @param  rdi  [in]  a
+; @param  rsi  [in]  an (старшие нулевые слова допускаются)
+; @param  rdx  [in]  b, b[bn-1] != 0
+; @param  rcx  [in]  bn >= 1
+; @param  r8   [out] out, bn слов (не пересекается с a)
+; @param  r9   [in]  work, max(an, bn) + 2 + 2 * bn слов
+; @clobbers rax, rcx, rdx, rsi, rdi, r8–r11, flags
+; =============================================================================
+align 16
+tree_mod:
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, 24
+
+.trim:
+    test    rsi, rsi
+    jz      .copy
+    cmp     qword [rdi + rsi * 8 - 8], 0
+    jne     .trimmed
+    dec     rsi
+    jmp     .trim
+.trimmed:
+    cmp     rsi, rcx
+    jb      .copy                       ; a < b
+    cmp     rcx, 1
+    je      .single
+
+    mov     [rsp], r8
+    mov     r12, rcx                    ; bn
+    mov     r10, rdx                    ; b
+    mov     r11, rsi                    ; an
+    mov     rbx, r9                     ; anorm: an + 1 слов
+    lea     rbp, [r9 + rsi * 8 + 8]     ; bnorm: bn слов
+    bsr     rcx, [r10 + r12 * 8 - 8]
+    xor     ecx, 63                     ; сдвиг нормализации
+    mov     [rsp + 8], rcx
+
+    ; 1. bnorm = b << sh, anorm = a << sh
+    mov     r13, r12
+.norm_b:
+    dec     r13
+    jz      .norm_b0
+    mov     rax, [r10 + r13 * 8]
+    mov     rdx, [r10 + r13 * 8 - 8]
+    shld    rax, rdx, cl
+    mov     [rbp + r13 * 8], rax
+    jmp     .norm_b
+.norm_b0:
+    mov     rax, [r10]
+    shl     rax, cl
+    mov     [rbp], rax
+
+    xor     eax, eax
+    mov     rdx, [rdi + r11 * 8 - 8]
+    shld    rax, rdx, cl
+    mov     [rbx + r11 * 8], rax
+    mov     r13, r11
+.norm_a:
+    dec     r13
+    jz      .norm_a0
+    mov     rax, [rdi + r13 * 8]
+    mov     rdx, [rdi + r13 * 8 - 8]
+    shld    rax, rdx, cl
+    mov     [rbx + r13 * 8], rax
+    jmp     .norm_a
+.norm_a0:
+    mov     rax, [rdi]
+    shl     rax, cl
+    mov     [rbx], rax
+
+    ; 2. Окна anorm[j..j+bn], j = an - bn .. 0
+    mov     r14, [rbp + r12 * 8 - 8]    ; d1
+    mov     r15, [rbp + r12 * 8 - 16]   ; d0
+    mov     r13, r11
+    sub     r13, r12
+    lea     r11, [rbp + r12 * 8]        ; q^ * bnorm: bn + 1 слов
+.q_loop:
+    lea     rsi, [rbx + r13 * 8]
+    mov     rdx, [rsi + r12 * 8]        ; u2 <= d1
+    mov     rax, [rsi + r12 * 8 - 8]    ; u1
+    cmp     rdx, r14
+    jae     .q_max
+    div     r14
+    mov     r9, rax                     ; q^
+    mov     r10, rdx                    ; r^
+.q_adjust:
+    mov     rax, r9
+    mul     r15
+    cmp     rdx, r10
+    ja      .q_dec
+    jb      .q_ok
+    cmp     rax, [rsi + r12 * 8 - 16]
+    jbe     .q_ok
+.q_dec:
+    dec     r9                          ; q^ * d0 > r^ * 2^64 + u0
+    add     r10, r14
+    jnc     .q_adjust
+    jmp     .q_ok
+.q_max:
+    mov     r9, -1                      ; u2 == d1: q^ = 2^64 - 1, r^ = u1 + d1
+    mov     r10, rax
+    add     r10, r14
+    jnc     .q_adjust
+
+.q_ok:
+    ; Окно -= q^ * bnorm двумя проходами: в совмещённом цикле перенос идёт
+    ; через add/adc/sub/adc (4 такта на слово), раздельно — 2 и 1
+    xor     r8d, r8d
+    xor     ecx, ecx
+.mul_loop:
+    mov     rax, [rbp + rcx * 8]
+    mul     r9
+    add     rax, r8
+    adc     rdx, 0
+    mov     [r11 + rcx * 8], rax
+    mov     r8, rdx
+    inc     rcx
+    cmp     rcx, r12
+    jb      .mul_loop
+    mov     [r11 + r12 * 8], r8
+
+    lea     r8, [r12 + 1]
+    xor     ecx, ecx                    ; CF = 0
+.sub_loop:
+    mov     rax, [rsi + rcx * 8]
+    sbb     rax, [r11 + rcx * 8]
+    mov     [rsi + rcx * 8], rax
+    lea     rcx, [rcx + 1]
+    dec     r8                          ; dec не меняет CF
+    jnz     .sub_loop
+    jnc     .q_next
+
+    ; q^ на единицу больше: окно += bnorm
+    mov     r8, r12
+    xor     ecx, ecx
+.add_loop:
+    mov     rax, [rbp + rcx * 8]
+    adc     [rsi + rcx * 8], rax
+    lea     rcx, [rcx + 1]
+    dec     r8
+    jnz     .add_loop
+    adc     qword [rsi + r12 * 8], 0
+
+.q_next:
+    dec     r13
+    jns     .q_loop
+
+    ; 3. out = anorm[0..bn) >> sh (anorm[bn] == 0)
+    mov     rdi, [rsp]
+    mov     rcx, [rsp + 8]
+    xor     r13d, r13d
+.unnorm:
+    mov     rax, [rbx + r13 * 8]
+    mov     rdx, [rbx + r13 * 8 + 8]
+    shrd    rax, rdx, cl
+    mov     [rdi + r13 * 8], rax
+    inc     r13
+    cmp     r13, r12
+    jb      .unnorm
+    jmp     .exit
+
+.single:
+    mov     r10, [rdx]
+    xor     edx, edx
+.single_loop:
+    mov     rax, [rdi + rsi * 8 - 8]
+    div     r10
+    dec     rsi
+    jnz     .single_loop
+    mov     [r8], rdx
+    jmp     .exit
+
+.copy:
+    xor     eax, eax
+.copy_loop:
+    cmp     rax, rsi
+    jae     .copy_zero
+    mov     rdx, [rdi + rax * 8]
+    mov     [r8 + rax * 8], rdx
+    inc     rax
+    jmp     .copy_loop
+.copy_zero:
+    cmp     rax, rcx
+    jae     .exit
+    mov     qword [r8 + rax * 8], 0
+    inc     rax
+    jmp     .copy_zero
+
+.exit:
+    add     rsp, 24
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
+
+; =============================================================================
+; @brief      Вычисляет rem[j] = n mod d[j] деревом остатков.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const uint64_t *n       (Делимое, len слов, младшее первым)
+;   - `rsi`: size_t len              (Число слов n)
+;   - `rdx`: const uint64_t *d       (Массив из k ненулевых модулей)
+;   - `rcx`: size_t k                (Число модулей)
+;   - `r8`:  uint64_t *rem           (Массив из k остатков)
+;   - `r9`:  uint64_t *scratch       (BIGNUM_MOD_U64_TREE_SCRATCH(len) слов)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** NULL (n при len == 0 не проверяется), нулевой модуль.
+;   2.  Для каждого блока из m <= TREE_BLOCK модулей:
+;       - **Выбор:** если len * (TREE_ROUTE_BITS * m - сумма длин модулей
+;         в битах) < TREE_ROUTE_COST * m, блок считается одним проходом
+;         bignum_mod_u64_multi_limbs, и шаги ниже пропускаются.
+;       - **Подъём:** уровень t + 1 из пар узлов уровня t (tree_mul; узел
+;         без пары копируется), пока не останется корень.
+;       - **Корень:** остаток n по корню (tree_mod).
+;       - **Спуск:** остаток каждого узла — остаток родителя по его
+;         произведению; на уровне 0 — искомые rem[j].
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_mod_u64_tree
+
+bignum_mod_u64_tree:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, F_SIZE
+
+    mov     [rsp + F_N], rdi
+    mov     [rsp + F_LEN], rsi
+    mov     [rsp + F_D], rdx
+    mov     [rsp + F_K], rcx
+    mov     [rsp + F_REM], r8
+    mov     rbx, r9                     ; scratch
+
+    ; 1. Валидация входных данных
+    test    rdx, rdx
+    jz      .err_null_ptr
+    test    r8, r8
+    jz      .err_null_ptr
+    test    r9, r9
+    jz      .err_null_ptr
+    test    rsi, rsi
+    jz      .n_checked
+    test    rdi, rdi
+    jz      .err_null_ptr
+.n_checked:
+
+    xor     eax, eax
+.zero_scan:
+    cmp     rax, rcx
+    je      .block_loop
+    cmp     qword [rdx + rax * 8], 0
+    je      .err_div_by_zero
+    inc     rax
+    jmp     .zero_scan
+
+    ; 2. Блоки по TREE_BLOCK модулей
+.block_loop:
+    mov     rax, [rsp + F_K]
+    test    rax, rax
+    jz      .done
+    mov     ecx, TREE_BLOCK
+    cmp     rax, rcx
+    cmovb   rcx, rax
+    mov     [rsp + F_M], rcx
+
+    ; Листья: уровень 0 = d[0..m), r8 = суммарная длина модулей в битах
+    mov     rsi, [rsp + F_D]
+    xor     eax, eax
+    xor     r8d, r8d
+.leaves:
+    mov     rdx, [rsi + rax * 8]
+    mov     [rbx + S_TREE * 8 + rax * 8], rdx
+    bsr     rdx, rdx
+    lea     r8, [r8 + rdx + 1]
+    inc     rax
+    cmp     rax, rcx
+    jb      .leaves
+
+    ; Дерево выгодно, только если len * (TREE_ROUTE_BITS * m - бит) >= TREE_ROUTE_COST * m
+    imul    rax, rcx, TREE_ROUTE_BITS
+    sub     rax, r8
+    imul    rax, [rsp + F_LEN]
+    imul    rdx, rcx, TREE_ROUTE_COST
+    cmp     rax, rdx
+    jb      .single_pass
+
+    ; 3. Подъём: r12 = t, r14 = узлов на уровне t, r15 = h = 2^t слов,
+    ;    rbp = левый ребёнок T[t][2i], родитель T[t+1][i] = rbp + TREE_BLOCK слов
+    xor     r12d, r12d
+    mov     r14, rcx
+.up_level:
+    cmp     r14, 1
+    je      .up_done
+    mov     ecx, r12d
+    mov     r15d, 1
+    shl     r15, cl
+    imul    rbp, r12, TREE_BLOCK * 8
+    lea     rbp, [rbx + rbp + S_TREE * 8]
+    xor     r13d, r13d
+.up_node:
+    lea     rdi, [rbp + TREE_BLOCK * 8]
+    lea     rcx, [r15 * 2]
+    xor     eax, eax
+.up_zero:
+    mov     [rdi + rcx * 8 - 8], rax
+    dec     rcx
+    jnz     .up_zero
+    lea     rax, [r13 * 2 + 1]
+    cmp     rax, r14
+    jae     .up_copy                    ; нет пары: произведение = левый ребёнок
+    TRIMMED_LEN rdx, rbp, r15
+    lea     rcx, [rbp + r15 * 8]
+    TRIMMED_LEN r8, rcx, r15
+    mov     rsi, rbp
+    call    tree_mul
+    jmp     .up_next
+.up_copy:
+    xor     ecx, ecx
+.up_copy_loop:
+    mov     rax, [rbp + rcx * 8]
+    mov     [rdi + rcx * 8], rax
+    inc     rcx
+    cmp     rcx, r15
+    jb      .up_copy_loop
+.up_next:
+    mov     rax, r15
+    shl     rax, 4
+    add     rbp, rax                    ; следующая пара: 2h слов
+    inc     r13
+    lea     rax, [r13 * 2]
+    cmp     rax, r14
+    jb      .up_node
+    inc     r14
+    shr     r14, 1                      ; ceil(cnt / 2)
+    inc     r12
+    jmp     .up_level
+
+    ; 4. Остаток n по корню T[top][0]
+.up_done:
+    mov     ecx, r12d
+    mov     r15d, 1
+    shl     r15, cl
+    imul    rdx, r12, TREE_BLOCK * 8
+    lea     rdx, [rbx + rdx + S_TREE * 8]
+    TRIMMED_LEN rcx, rdx, r15
+    mov     rdi, [rsp + F_N]
+    mov     rsi, [rsp + F_LEN]
+    lea     r8, [rbx + S_REM_A * 8]
+    lea     r9, [rbx + S_WORK * 8]
+    mov     [rsp + F_CUR], r8
+    lea     rax, [rbx + S_REM_B * 8]
+    mov     [rsp + F_NEXT], rax
+    call    tree_mod
+
+    ; 5. Спуск: узел i уровня t — остаток родителя (i & ~1 в слотах h) mod T[t][i]
+.down_level:
+    dec     r12
+    js      .down_done
+    mov     ecx, r12d
+    mov     r15d, 1
+    shl     r15, cl
+    mov     r14, [rsp + F_M]
+    add     r14, r15
+    dec     r14
+    shr     r14, cl                     ; ceil(m / 2^t)
+    imul    rax, r12, TREE_BLOCK * 8
+    lea     rax, [rbx + rax + S_TREE * 8]
+    mov     [rsp + F_LVL], rax
+    xor     r13d, r13d
+.down_node:
+    mov     rbp, r13
+    imul    rbp, r15                    ; i * h
+    mov     rax, r13
+    and     rax, -2
+    imul    rax, r15                    ; (i & ~1) * h
+    mov     rdx, [rsp + F_LVL]
+    lea     r10, [rdx + rax * 8 + TREE_BLOCK * 8]
+    lea     rdx, [rdx + rbp * 8]
+    lea     r11, [r15 * 2]
+    TRIMMED_LEN rsi, r10, r11
+    TRIMMED_LEN rcx, rdx, r15
+    mov     rdi, [rsp + F_CUR]
+    lea     rdi, [rdi + rax * 8]
+    mov     r8, [rsp + F_NEXT]
+    lea     r8, [r8 + rbp * 8]
+    lea     r9, [rbx + S_WORK * 8]
+    call    tree_mod
+    inc     r13
+    cmp     r13, r14
+    jb      .down_node
+    mov     rax, [rsp + F_CUR]
+    mov     rdx, [rsp + F_NEXT]
+    mov     [rsp + F_CUR], rdx
+    mov     [rsp + F_NEXT], rax
+    jmp     .down_level
+
+    ; 6. Уровень 0 — остатки блока
+.down_done:
+    mov     rsi, [rsp + F_CUR]
+    mov     rdi, [rsp + F_REM]
+    mov     rcx, [rsp + F_M]
+    xor     eax, eax
+.store:
+    mov     rdx, [rsi + rax * 8]
+    mov     [rdi + rax * 8], rdx
+    inc     rax
+    cmp     rax, rcx
+    jb      .store
+.next_block:
+    lea     rax, [rcx * 8]
+    add     [rsp + F_D], rax
+    add     [rsp + F_REM], rax
+    sub     [rsp + F_K], rcx
+    jmp     .block_loop
+
+.single_pass:
+    ; Короткое n или широкие модули: один проход по словам n на блок
+    mov     rdi, [rsp + F_N]
+    mov     rsi, [rsp + F_LEN]
+    mov     rdx, [rsp + F_D]
+    mov     r8, [rsp + F_REM]
+    call    bignum_mod_u64_multi_limbs
+    mov     rcx, [rsp + F_M]
+    jmp     .next_block
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+
+.exit:
+    ; --- Эпилог ---
+    add     rsp, F_SIZE
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
@@ -0,0 +1,335 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_remove_factor_u64.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    16.10.2026
+;
+; @brief   Удаление множителя p из большого числа с подсчётом кратности.
+;
+; @details
+;   Реализует функцию bignum_remove_factor_u64 на ассемблере x86-64
+;   (синтаксис YASM) в соответствии с System V AMD64 ABI.
+;
+;   Степени P_i = p^(2^i), помещающиеся в 64 бита (P_0..P_T), проверяются
+;   окнами до DIVISIBLE_WINDOW штук одним вызовом bignum_divisible_u64_multi
+;   (один проход по n); по результату n делится на наибольшую подходящую
+;   степень через bignum_divexact_u64. Делимость монотонна (P_(i+1) | n
+;   влечёт P_i | n), поэтому результаты окна — префикс из f единиц.
+;
+;   Сначала один вызов bignum_divisible_u64 отсекает частый случай p ∤ n
+;   (кратность 0) за проход без деления. Если p | n, первое окно начинается
+;   с P_1: P_0 заново не проверяется.
+;
+;   - Подъём: окно [lo, lo + g). f == g — деление на верхнюю степень окна
+;     и новое окно от неё (кратность может оказаться больше); f < g —
+;     кратность e меньше 2^(lo + f), переход к спуску.
+;   - Спуск при известной границе e < 2^(hi + 1): окно из верхних g
+;     степеней до P_hi; после деления на P_b граница становится 2^b.
+;
+;   p = 2^k обрабатывается отдельно: кратность — число младших нулевых бит
+;   n, делённое на k, а n сдвигается вправо за один проход.
+;
+; @history
+;   - rev. 1 (16.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+%define DIVISIBLE_WINDOW 4      ; степеней на проверку: одна группа полос
+
+%define F_POW    0              ; uint64_t P[8]
+%define F_FLAGS  64             ; bool flags[DIVISIBLE_WINDOW]
+%define F_SIZE   88             ; rsp кратен 16 после пролога
+
+extern bignum_divisible_u64
+extern bignum_divisible_u64_multi
+extern bignum_divexact_u64
+
+; =============================================================================
+; @brief  Проверяет делимость n на P_%1..P_(%1 + %2 - 1).
+;
+; @param  %1   [in] индекс первой степени (регистр, кроме rdi/rsi/rdx/rcx)
+; @param  %2   [in] число степеней, 1..DIVISIBLE_WINDOW (регистр)
+; @param  rbx  [in] n
+; @return eax = f, число делящих степеней (префикс окна)
+; @clobbers rax, rcx, rdx, rsi, rdi, r8–r11, flags
+; =============================================================================
+%macro TEST_WINDOW 2
+    lea     rsi, [rsp + F_POW + %1 * 8]
+    mov     rdi, rbx
+    mov     rdx, %2
+    lea     rcx, [rsp + F_FLAGS]
+    call    bignum_divisible_u64_multi
+    xor     eax, eax
+%%count:
+    cmp     eax, %2d
+    je      %%done
+    cmp     byte [rsp + F_FLAGS + rax], 0
+    je      %%done
+    inc     eax
+    jmp     %%count
+%%done:
+%endmacro
+
+; =============================================================================
+; @brief  n /= P_%1 на месте, кратность += 2^%1.
+;
+; @param  %1   [in] индекс степени (регистр rbx/rbp/r12–r15)
+; @param  rbx  [in] n
+; @param  r12  [in/out] кратность
+; @clobbers rax, rcx, rdx, rsi, rdi, r8–r11, flags
+; =============================================================================
+%macro DIVIDE_POWER 1
+    mov     rdi, rbx
+    mov     rsi, rbx
+    mov     rdx, [rsp + F_POW + %1 * 8]
+    call    bignum_divexact_u64
+    mov     ecx, %1d
+    mov     eax, 1
+    shl     eax, cl
+    add     r12d, eax
+%endmacro
+
+section .text
+
+; =============================================================================
+; @brief      Делит n на наибольшую степень p, делящую n, и возвращает её показатель.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: bignum_t *n             (Указатель на число, изменяется на месте)
+;   - `rsi`: uint64_t p              (Удаляемый множитель, p >= 2)
+;   - `rdx`: unsigned *count         (Указатель на кратность)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** NULL, длина, p == 0 (-2), p == 1 (-5). Длина
+;       уточняется без старших нулевых слов; n = 0 — кратность 0, n не
+;       меняется.
+;   2.  **p = 2^k:** сдвиг вправо на k * floor(tz(n) / k) бит.
+;   3.  **Степени:** P_0 = p, P_(i+1) = P_i^2, пока произведение < 2^64.
+;   4.  **Подъём и спуск** окнами (см. описание файла).
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -4, -5)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_remove_factor_u64
+
+bignum_remove_factor_u64:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, F_SIZE
+
+    mov     rbx, rdi    ; n
+    mov     r15, rsi    ; p
+    mov     rbp, rdx    ; count
+
+    ; 1. Валидация входных данных
+    test    rbx, rbx
+    jz      .err_null_ptr
+    test    rbp, rbp
+    jz      .err_null_ptr
+
+    mov     r8d, [rbx + BIGNUM_LEN_OFFSET]
+    test    r8d, r8d
+    js      .err_bad_length
+    cmp     r8d, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    test    r15, r15
+    jz      .err_div_by_zero
+    cmp     r15, 1
+    je      .err_unsupported
+
+    xor     r12d, r12d                  ; кратность
+.trim_len:
+    test    r8d, r8d
+    jz      .done                       ; n = 0 (в том числе из нулевых слов)
+    cmp     qword [rbx + r8 * 8 - 8], 0
+    jne     .len_trimmed
+    dec     r8d                         ; старшие нулевые слова не считаются
+    jmp     .trim_len
+.len_trimmed:
+
+    lea     rax, [r15 - 1]
+    test    rax, r15
+    jz      .power_of_two
+
+    ; Чаще всего p не делит n: один проход двух цепочек bignum_divisible_u64
+    mov     rdi, rbx
+    mov     rsi, r15
+    lea     rdx, [rsp + F_FLAGS]
+    call    bignum_divisible_u64
+    cmp     byte [rsp + F_FLAGS], 0
+    je      .done
+
+    ; 3. Степени P_0..P_T
+    mov     [rsp + F_POW], r15
+    xor     r13d, r13d                  ; T
+    mov     rax, r15
+.power_loop:
+    mul     rax
+    test    rdx, rdx
+    jnz     .ascend_start               ; P_(T+1) >= 2^64
+    inc     r13d
+    mov     [rsp + F_POW + r13 * 8], rax
+    jmp     .power_loop
+
+    ; 4a. Подъём: r14 = lo, r15 = g
+.ascend_start:
+    mov     r14d, 1                     ; P_0 | n уже известно: окно с P_1
+    test    r13d, r13d
+    jnz     .ascend
+    xor     r14d, r14d                  ; T = 0: окно {P_0}, f = g = 1
+    mov     r15d, 1
+    mov     eax, r15d
+    jmp     .ascend_hit
+.ascend:
+    mov     r15d, r13d
+    sub     r15d, r14d
+    inc     r15d
+    mov     eax, DIVISIBLE_WINDOW
+    cmp     r15d, eax
+    cmova   r15d, eax                   ; g = min(T - lo + 1, 4)
+    TEST_WINDOW r14, r15
+    test    eax, eax
+    jz      .ascend_none
+.ascend_hit:
+    cmp     eax, r15d
+    setb    r15b                        ; f < g: граница найдена
+    lea     r14d, [r14 + rax - 1]      ; b = lo + f - 1
+    DIVIDE_POWER r14
+    test    r15b, r15b
+    jnz     .descend_below              ; e' < 2^b
+    cmp     r14d, r13d
+    jb      .ascend                     ; lo = b
+    lea     r14d, [r13 - (DIVISIBLE_WINDOW - 1)]
+    xor     eax, eax
+    test    r14d, r14d
+    cmovs   r14d, eax                   ; lo = max(0, T - 3)
+    jmp     .ascend
+
+.ascend_none:
+    test    r12d, r12d
+    jz      .ascend_hit                 ; первое окно с P_1: e = 1, b = 0
+    dec     r14d                        ; e < 2^lo: hi = lo - 1
+    jmp     .descend
+
+    ; 4b. Спуск: r14 = hi (e < 2^(hi + 1)), r15 = g
+.descend_below:
+    dec     r14d                        ; hi = b - 1
+.descend:
+    test    r14d, r14d
+    js      .done
+    lea     r15d, [r14 + 1]
+    mov     eax, DIVISIBLE_WINDOW
+    cmp     r15d, eax
+    cmova   r15d, eax                   ; g = min(hi + 1, 4)
+    mov     eax, r14d
+    sub     eax, r15d
+    inc     eax                         ; base = hi - g + 1
+    TEST_WINDOW rax, r15
+    test    eax, eax
+    jnz     .descend_hit
+    sub     r14d, r15d                  ; ни одна: hi -= g
+    jmp     .descend
+.descend_hit:
+    sub     r14d, r15d
+    add     r14d, eax                   ; b = base + f - 1 = hi - g + f
+    DIVIDE_POWER r14
+    jmp     .descend_below
+
+    ; 2. p = 2^k: сдвиг вправо на S = k * floor(tz(n) / k) бит
+.power_of_two:
+    bsf     r9, r15                     ; k
+    xor     ecx, ecx
+.tz_scan:
+    mov     rax, [rbx + rcx * 8]
+    test    rax, rax
+    jnz     .tz_found
+    inc     ecx
+    cmp     ecx, r8d
+    jb      .tz_scan                    ; words[len - 1] != 0 после .trim_len
+    jmp     .done
+.tz_found:
+    bsf     rax, rax
+    shl     ecx, 6
+    add     eax, ecx                    ; tz(n)
+    xor     edx, edx
+    div     r9d
+    mov     r12d, eax                   ; кратность
+    imul    eax, r9d                    ; S
+    mov     r9d, eax
+    shr     r9d, 6                      ; сдвиг в словах
+    mov     ecx, eax
+    and     ecx, 63                     ; сдвиг в битах
+    mov     r10d, r8d
+    sub     r10d, r9d                   ; новая длина до нормализации (>= 1)
+    xor     r11d, r11d                  ; i
+    lea     rsi, [rbx + r9 * 8]         ; &n->words[ws]
+.shift_loop:
+    mov     rax, [rsi + r11 * 8]
+    xor     edx, edx
+    lea     edi, [r11 + 1]
+    cmp     edi, r10d
+    jae     .shift_top
+    mov     rdx, [rsi + r11 * 8 + 8]
+.shift_top:
+    shrd    rax, rdx, cl
+    mov     [rbx + r11 * 8], rax
+    inc     r11d
+    cmp     r11d, r10d
+    jb      .shift_loop
+.clear_loop:
+    cmp     r11d, r8d
+    jae     .shift_len
+    mov     qword [rbx + r11 * 8], 0
+    inc     r11d
+    jmp     .clear_loop
+.shift_len:
+    test    r10d, r10d
+    jz      .shift_done
+    cmp     qword [rbx + r10 * 8 - 8], 0
+    jne     .shift_done
+    dec     r10d                        ; старшие слова обнулились сдвигом
+    jmp     .shift_len
+.shift_done:
+    mov     [rbx + BIGNUM_LEN_OFFSET], r10d
+
+.done:
+    mov     [rbp], r12d
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+    jmp     .exit
+
+.err_unsupported:
+    mov     eax, BIGNUM_DIV_U64_ERR_UNSUPPORTED
+
+.exit:
+    ; --- Эпилог ---
+    add     rsp, F_SIZE
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
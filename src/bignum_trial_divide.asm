@@ -0,0 +1,222 @@
+; -----------------------------------------------------------------------------
+; @file    bignum_trial_divide.asm
+; @author  git@bayborodov.com
+; @version 1.0.0
+; @date    16.10.2026
+;
+; @brief   Пробное деление большого числа на список 32-битных простых.
+;
+; @details
+;   Реализует функцию bignum_trial_divide на ассемблере x86-64 (синтаксис
+;   YASM) в соответствии с System V AMD64 ABI.
+;
+;   Подряд идущие простые жадно упаковываются в произведения P < 2^64
+;   (от двух-трёх больших простых до десятков малых). Остатки n mod P
+;   считаются по TRIAL_CHUNK произведений за один проход по n через
+;   bignum_mod_u64_multi, а каждый 64-битный остаток затем раскладывается
+;   на остатки по простым своего произведения одной командой div:
+;   (n mod P) mod p = n mod p, так как p | P.
+;
+;   Без битовой карты работа прекращается на первой группе с делителем.
+;
+; @history
+;   - rev. 1 (16.10.2026): Первоначальная реализация.
+; -----------------------------------------------------------------------------
+
+%include "bignum_div_u64.inc"
+
+%define TRIAL_CHUNK  32                 ; произведений на проход по n
+
+%define F_N        0
+%define F_DIVISOR  8
+%define F_BITMAP   16
+%define F_PROD     24                           ; uint64_t prod[TRIAL_CHUNK]
+%define F_REM      (F_PROD + TRIAL_CHUNK * 8)   ; uint64_t rem[TRIAL_CHUNK]
+%define F_CNT      (F_REM + TRIAL_CHUNK * 8)    ; uint32_t cnt[TRIAL_CHUNK]: простых в prod[t]
+%define F_SIZE     (F_CNT + TRIAL_CHUNK * 4)    ; rsp кратен 16 после пролога
+
+extern bignum_mod_u64_multi
+
+section .text
+
+; =============================================================================
+; @brief      Ищет простые из списка, делящие n.
+;
+; @details
+;   ### Протокол вызова (ABI)
+;   - `rdi`: const bignum_t *n       (Указатель на проверяемое число)
+;   - `rsi`: const uint32_t *primes  (Массив ненулевых делителей)
+;   - `rdx`: size_t count            (Число делителей)
+;   - `rcx`: uint32_t *divisor       (Первый делитель n из списка или 0)
+;   - `r8`:  uint64_t *bitmap        (NULL или (count + 63) / 64 слов)
+;   - `rax`: bignum_div_u64_status_t (Возвращаемый код состояния)
+;
+;   ### Алгоритм
+;   1.  **Валидация:** NULL, длина, нулевой элемент `primes` — до записи
+;       результатов. `*divisor = 0`, карта обнуляется.
+;   2.  **Упаковка:** до TRIAL_CHUNK произведений подряд идущих простых.
+;   3.  **Остатки** по произведениям — bignum_mod_u64_multi.
+;   4.  **Разложение:** `div` остатка на каждое простое; ноль — делитель.
+;       Первый делитель пишется в `*divisor`; без карты — выход.
+;
+; @abi        System V AMD64 ABI
+; @return     rax: bignum_div_u64_status_t (0, -1, -2, -4)
+; @clobbers   rcx, rdx, rsi, rdi, r8–r11
+; =============================================================================
+align 16
+global bignum_trial_divide
+
+bignum_trial_divide:
+    ; --- Пролог ---
+    push    rbx
+    push    rbp
+    push    r12
+    push    r13
+    push    r14
+    push    r15
+    sub     rsp, F_SIZE
+
+    mov     [rsp + F_N], rdi
+    mov     [rsp + F_DIVISOR], rcx
+    mov     [rsp + F_BITMAP], r8
+    mov     rbx, rsi    ; primes
+    mov     rbp, rdx    ; count
+
+    ; 1. Валидация входных данных
+    test    rdi, rdi
+    jz      .err_null_ptr
+    test    rsi, rsi
+    jz      .err_null_ptr
+    test    rcx, rcx
+    jz      .err_null_ptr
+
+    mov     eax, [rdi + BIGNUM_LEN_OFFSET]
+    test    eax, eax
+    js      .err_bad_length
+    cmp     eax, BIGNUM_CAPACITY
+    jg      .err_bad_length
+
+    xor     eax, eax
+.zero_scan:
+    cmp     rax, rbp
+    je      .scan_done
+    cmp     dword [rbx + rax * 4], 0
+    je      .err_div_by_zero
+    inc     rax
+    jmp     .zero_scan
+.scan_done:
+
+    mov     dword [rcx], 0
+    test    r8, r8
+    jz      .chunks
+    lea     rcx, [rbp + 63]
+    shr     rcx, 6
+    mov     rdi, r8
+    xor     eax, eax
+    rep     stosq
+
+.chunks:
+    xor     r12d, r12d                  ; следующий неупакованный primes[i]
+.chunk_loop:
+    cmp     r12, rbp
+    je      .done
+    mov     r13, r12                    ; первое простое группы
+    xor     r14d, r14d                  ; число произведений
+
+    ; 2. Упаковка: prod[t] = primes[i] * primes[i + 1] * ... < 2^64
+.pack:
+    mov     eax, [rbx + r12 * 4]
+    inc     r12
+    mov     r15d, 1
+.pack_more:
+    cmp     r12, rbp
+    je      .pack_store
+    mov     ecx, [rbx + r12 * 4]
+    mov     rsi, rax
+    mul     rcx
+    test    rdx, rdx
+    jnz     .pack_full
+    inc     r12
+    inc     r15d
+    jmp     .pack_more
+.pack_full:
+    mov     rax, rsi                    ; следующее простое не помещается
+.pack_store:
+    mov     [rsp + F_PROD + r14 * 8], rax
+    mov     [rsp + F_CNT + r14 * 4], r15d
+    inc     r14
+    cmp     r14, TRIAL_CHUNK
+    je      .reduce
+    cmp     r12, rbp
+    jne     .pack
+
+    ; 3. Остатки по всем произведениям группы за один проход по n
+.reduce:
+    mov     rdi, [rsp + F_N]
+    lea     rsi, [rsp + F_PROD]
+    mov     rdx, r14
+    lea     rcx, [rsp + F_REM]
+    call    bignum_mod_u64_multi
+
+    ; 4. Разложение остатков: r13 — индекс простого, r15 — произведения
+    xor     r15d, r15d
+.split_product:
+    mov     r8, [rsp + F_REM + r15 * 8]
+    mov     r9d, [rsp + F_CNT + r15 * 4]
+.split_prime:
+    mov     ecx, [rbx + r13 * 4]
+    mov     rax, r8
+    xor     edx, edx
+    div     rcx
+    test    rdx, rdx
+    jz      .hit
+.split_next:
+    inc     r13
+    dec     r9d
+    jnz     .split_prime
+    inc     r15
+    cmp     r15, r14
+    jb      .split_product
+    jmp     .chunk_loop
+
+.hit:
+    mov     rax, [rsp + F_DIVISOR]
+    cmp     dword [rax], 0
+    jne     .hit_bitmap
+    mov     [rax], ecx                  ; первый по порядку делитель
+.hit_bitmap:
+    mov     rax, [rsp + F_BITMAP]
+    test    rax, rax
+    jz      .done                       ; нужен только первый
+    mov     rdx, r13
+    shr     rdx, 6
+    mov     rsi, [rax + rdx * 8]
+    bts     rsi, r13                    ; бит r13 mod 64
+    mov     [rax + rdx * 8], rsi
+    jmp     .split_next
+
+.done:
+    mov     eax, BIGNUM_DIV_U64_OK
+    jmp     .exit
+
+.err_null_ptr:
+    mov     eax, BIGNUM_DIV_U64_ERR_NULL_PTR
+    jmp     .exit
+
+.err_bad_length:
+    mov     eax, BIGNUM_DIV_U64_ERR_BAD_LENGTH
+    jmp     .exit
+
+.err_div_by_zero:
+    mov     eax, BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO
+
+.exit:
+    ; --- Эпилог ---
+    add     rsp, F_SIZE
+    pop     r15
+    pop     r14
+    pop     r13
+    pop     r12
+    pop     rbp
+    pop     rbx
+    ret
@@ -24,6 +24,9 @@
  *                         - Восстановлена полная история ревизий.
  *                         - Добавлен тест `test_error_bad_length` для проверки
  *                           нового кода ошибки BIGNUM_DIV_U64_ERR_BAD_LENGTH.
+ *   - rev. 3 (15.10.2026): `q == n` теперь означает деление на месте:
+ *                         test_error_buffer_overlap заменён на
+ *                         test_in_place_division.
  */
 
 #include "bignum_div_u64.h"
@@ -174,12 +177,32 @@ void test_error_division_by_zero() {
     ASSERT_TRUE(bignum_div_u64(&q, &n, d, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Handles division by zero");
 }
 
-void test_error_buffer_overlap() {
-    bignum_t n;
-    uint64_t d = 2, r;
+void test_in_place_division() {
+    bignum_t n, q_expected;
+    uint64_t d = 2, r = 1;
     bignum_from_u64(&n, 10);
+    bignum_from_u64(&q_expected, 5);
     // Передаем один и тот же bignum в качестве q и n
-    ASSERT_TRUE(bignum_div_u64(&n, &n, d, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP, "Handles buffer overlap");
+    ASSERT_TRUE(bignum_div_u64(&n, &n, d, &r) == BIGNUM_DIV_U64_OK, "In-place division is allowed");
+    ASSERT_TRUE(bignum_are_equal(&n, &q_expected) && r == 0, "In-place quotient is correct");
+
+    // Многократное деление на месте: перевод 2^128 - 1 в десятичную систему
+    static const char expected[] = "340282366920938463463374607431768211455";
+    char digits[64];
+    int count = 0;
+    memset(&n, 0, sizeof(n));
+    n.len = 2;
+    n.words[0] = UINT64_MAX;
+    n.words[1] = UINT64_MAX;
+    while (n.len > 0 && count < (int)sizeof(digits)) {
+        bignum_div_u64(&n, &n, 10, &r);
+        digits[count++] = (char)('0' + r);
+    }
+    bool ok = count == (int)strlen(expected);
+    for (int i = 0; ok && i < count; ++i) {
+        ok = digits[count - 1 - i] == expected[i];
+    }
+    ASSERT_TRUE(ok, "Repeated in-place division converts to decimal");
 }
 
 
@@ -200,7 +223,7 @@ int main() {
     RUN_TEST(test_leading_zeros_in_dividend);
     RUN_TEST(test_error_null_pointer);
     RUN_TEST(test_error_division_by_zero);
-    RUN_TEST(test_error_buffer_overlap);
+    RUN_TEST(test_in_place_division);
     RUN_TEST(test_error_bad_length);
 
     printf("----------------------------------------\n");
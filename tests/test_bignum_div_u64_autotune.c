@@ -0,0 +1,174 @@
+/**
+ * @file    test_bignum_div_u64_autotune.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты автонастройки ядра bignum_div_u64.
+ *
+ * @details
+ *   Проверяет установку таблицы ядер по корзинам, корректность деления
+ *   после настройки (сравнение с эталоном на unsigned __int128), запись,
+ *   повторное чтение и перезапись повреждённого файла кэша, а также возврат
+ *   к фиксированному ядру.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+__extension__ typedef unsigned __int128 u128_t;
+
+#define CACHE_FILE "test_bignum_div_u64_autotune.cache"
+#define CACHE_SIZE 80
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x165667B19E3779F9ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/** Делит случайные числа всех длин и сверяет с эталоном на unsigned __int128. */
+static bool check_division(void) {
+    for (int round = 0; round < 40; ++round) {
+        uint64_t d = rng_next() >> (rng_next() % 64);
+        if (d == 0) d = 3;
+        for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            bignum_t n, q;
+            uint64_t r;
+            u128_t rr = 0;
+            memset(&n, 0, sizeof(n));
+            n.len = len;
+            for (int i = 0; i < len; ++i) n.words[i] = rng_next();
+            if (bignum_div_u64(&q, &n, d, &r) != BIGNUM_DIV_U64_OK) return false;
+            for (int i = len - 1; i >= 0; --i) {
+                u128_t cur = (rr << 64) | n.words[i];
+                if (q.words[i] != (uint64_t)(cur / d)) return false;
+                rr = cur % d;
+            }
+            if (r != (uint64_t)rr) return false;
+        }
+    }
+    return true;
+}
+
+/** Проверяет, что для всех корзин выбрано допустимое ядро. */
+static bool buckets_valid(void) {
+    static const size_t lens[] = {0, 1, 4, 5, 16, 17, 32};
+    static const uint64_t divs[] = {1, 0xFFFFFFFFull, 0x100000000ull, 0xFFFFFFFFFFFFFFFFull};
+    for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); ++i) {
+        for (size_t j = 0; j < sizeof(divs) / sizeof(divs[0]); ++j) {
+            if ((unsigned)bignum_div_u64_kernel_for(lens[i], divs[j]) >= BIGNUM_DIV_U64_KERNEL_COUNT) return false;
+        }
+    }
+    return true;
+}
+
+/** Читает файл кэша; возвращает число прочитанных байт. */
+static size_t read_cache(unsigned char *buf, size_t size) {
+    FILE *f = fopen(CACHE_FILE, "rb");
+    if (!f) return 0;
+    size_t got = fread(buf, 1, size, f);
+    fclose(f);
+    return got;
+}
+
+// --- Тестовые случаи ---
+
+void test_autotune_without_cache(void) {
+    ASSERT_TRUE(bignum_div_u64_autotune(NULL) == BIGNUM_DIV_U64_OK, "Autotune returns OK");
+    ASSERT_TRUE(bignum_div_u64_get_kernel() == BIGNUM_DIV_U64_KERNEL_AUTOTUNED, "Kernel reported as autotuned");
+    ASSERT_TRUE(strcmp(bignum_div_u64_kernel_name(BIGNUM_DIV_U64_KERNEL_AUTOTUNED), "autotuned") == 0, "Autotuned kernel name");
+    ASSERT_TRUE(buckets_valid(), "Every bucket has a valid kernel");
+    ASSERT_TRUE(check_division(), "Division matches reference after autotune");
+}
+
+void test_autotune_cache(void) {
+    unsigned char first[CACHE_SIZE + 1], second[CACHE_SIZE + 1];
+    remove(CACHE_FILE);
+
+    ASSERT_TRUE(bignum_div_u64_autotune(CACHE_FILE) == BIGNUM_DIV_U64_OK, "Autotune with cache returns OK");
+    ASSERT_TRUE(read_cache(first, sizeof(first)) == CACHE_SIZE, "Cache file written with 80 bytes");
+    ASSERT_TRUE(memcmp(first, "BDU64AT1", 8) == 0, "Cache file has signature");
+
+    ASSERT_TRUE(bignum_div_u64_set_kernel(BIGNUM_DIV_U64_KERNEL_PREINV) == BIGNUM_DIV_U64_OK, "Fixed kernel restored");
+    ASSERT_TRUE(bignum_div_u64_autotune(CACHE_FILE) == BIGNUM_DIV_U64_OK, "Autotune from cache returns OK");
+    ASSERT_TRUE(bignum_div_u64_get_kernel() == BIGNUM_DIV_U64_KERNEL_AUTOTUNED, "Cached table installed");
+    bool same = true;
+    for (int b = 0; b < 6; ++b) {
+        size_t len = (b % 3 == 0) ? 3 : (b % 3 == 1) ? 10 : 32;
+        uint64_t d = (b < 3) ? 1000000000ull : 10000000000000000000ull;
+        if ((unsigned)bignum_div_u64_kernel_for(len, d) != first[72 + b]) same = false;
+    }
+    ASSERT_TRUE(same, "Cached table matches file contents");
+    ASSERT_TRUE(check_division(), "Division matches reference with cached table");
+
+    FILE *f = fopen(CACHE_FILE, "wb");
+    if (f) {
+        fputs("garbage", f);
+        fclose(f);
+    }
+    ASSERT_TRUE(bignum_div_u64_autotune(CACHE_FILE) == BIGNUM_DIV_U64_OK, "Autotune ignores corrupt cache");
+    ASSERT_TRUE(read_cache(second, sizeof(second)) == CACHE_SIZE, "Corrupt cache rewritten");
+    ASSERT_TRUE(memcmp(first, second, 72) == 0, "Rewritten cache has the same CPU key");
+
+    remove(CACHE_FILE);
+}
+
+void test_autotune_unwritable_cache(void) {
+    ASSERT_TRUE(bignum_div_u64_autotune("/nonexistent-dir/bignum.cache") == BIGNUM_DIV_U64_OK, "Unwritable cache path is not an error");
+    ASSERT_TRUE(bignum_div_u64_get_kernel() == BIGNUM_DIV_U64_KERNEL_AUTOTUNED, "Table installed without cache");
+}
+
+void test_set_kernel_after_autotune(void) {
+    ASSERT_TRUE(bignum_div_u64_set_kernel(BIGNUM_DIV_U64_KERNEL_HWDIV) == BIGNUM_DIV_U64_OK, "Fixed kernel set after autotune");
+    ASSERT_TRUE(bignum_div_u64_get_kernel() == BIGNUM_DIV_U64_KERNEL_HWDIV, "Fixed kernel reported");
+    ASSERT_TRUE(bignum_div_u64_kernel_for(32, 7) == BIGNUM_DIV_U64_KERNEL_HWDIV, "Buckets follow fixed kernel");
+    ASSERT_TRUE(check_division(), "Division matches reference with fixed kernel");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64_autotune ===\n");
+
+    RUN_TEST(test_autotune_without_cache);
+    RUN_TEST(test_autotune_cache);
+    RUN_TEST(test_autotune_unwritable_cache);
+    RUN_TEST(test_set_kernel_after_autotune);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
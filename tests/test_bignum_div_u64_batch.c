@@ -0,0 +1,209 @@
+/**
+ * @file    test_bignum_div_u64_batch.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты пакетного деления bignum_div_u64_batch.
+ *
+ * @details
+ *   Сравнивает результат каждого элемента пакета с bignum_div_u64 для
+ *   чётных и нечётных размеров пакета, разных длин (включая нулевые)
+ *   и разных делителей, а также проверяет, что при ошибке валидации
+ *   выходные буферы не изменяются.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ *   - rev. 2 (15.10.2026): Проверка деления на месте (q[k] == n[k]).
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define MAX_BATCH 9
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x2545F4914F6CDD1Dull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** Делит пакет из count случайных чисел и сверяет каждый элемент с bignum_div_u64. */
+static bool check_batch(size_t count, uint64_t d) {
+    static bignum_t n[MAX_BATCH], q[MAX_BATCH], q_ref;
+    bignum_t *qp[MAX_BATCH];
+    const bignum_t *np[MAX_BATCH];
+    uint64_t rem[MAX_BATCH], r_ref;
+
+    for (size_t k = 0; k < count; ++k) {
+        int len = (int)(rng_next() % (BIGNUM_CAPACITY + 1));
+        if (rng_next() % 5 == 0) len = 0;
+        bignum_random(&n[k], len);
+        memset(&q[k], 0x5A, sizeof(q[k]));
+        qp[k] = &q[k];
+        np[k] = &n[k];
+        rem[k] = 0xDEADBEEF;
+    }
+    if (bignum_div_u64_batch(qp, np, count, d, rem) != BIGNUM_DIV_U64_OK) return false;
+    for (size_t k = 0; k < count; ++k) {
+        if (bignum_div_u64(&q_ref, &n[k], d, &r_ref) != BIGNUM_DIV_U64_OK) return false;
+        if (q_ref.len != q[k].len || r_ref != rem[k]) return false;
+        if (memcmp(q_ref.words, q[k].words, sizeof(q_ref.words)) != 0) return false;
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_batch_matches_single() {
+    static const uint64_t divisors[] = {
+        1, 3, 10, 0xFFFFFFFFull, 1000000000000000000ull,
+        0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull
+    };
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(divisors) / sizeof(divisors[0]); ++i) {
+        for (size_t count = 1; count <= MAX_BATCH; ++count) {
+            for (int round = 0; round < 8; ++round) {
+                ok = ok && check_batch(count, divisors[i]);
+            }
+        }
+    }
+    ASSERT_TRUE(ok, "Every element matches bignum_div_u64 (edge divisors)");
+
+    ok = true;
+    for (int round = 0; round < 200; ++round) {
+        uint64_t d = rng_next() >> (rng_next() % 64);
+        ok = ok && check_batch(1 + rng_next() % MAX_BATCH, d ? d : 1);
+    }
+    ASSERT_TRUE(ok, "Every element matches bignum_div_u64 (random divisors)");
+}
+
+void test_empty_batch() {
+    bignum_t *qp[1] = { NULL };
+    const bignum_t *np[1] = { NULL };
+    uint64_t rem[1];
+    ASSERT_TRUE(bignum_div_u64_batch(qp, np, 0, 7, rem) == BIGNUM_DIV_U64_OK, "Empty batch is OK");
+}
+
+void test_all_zero_lengths() {
+    bignum_t n[2], q[2];
+    bignum_t *qp[2] = { &q[0], &q[1] };
+    const bignum_t *np[2] = { &n[0], &n[1] };
+    uint64_t rem[2] = { 1, 1 };
+    memset(n, 0, sizeof(n));
+    memset(q, 0xFF, sizeof(q));
+    ASSERT_TRUE(bignum_div_u64_batch(qp, np, 2, 7, rem) == BIGNUM_DIV_U64_OK, "Status is OK");
+    ASSERT_TRUE(q[0].len == 0 && q[1].len == 0 && q[0].words[0] == 0 && q[1].words[BIGNUM_CAPACITY - 1] == 0,
+                "Zero dividends give zero quotients");
+    ASSERT_TRUE(rem[0] == 0 && rem[1] == 0, "Zero dividends give zero remainders");
+}
+
+void test_in_place_batch() {
+    static bignum_t n[MAX_BATCH], n_copy[MAX_BATCH], q_ref;
+    bignum_t *qp[MAX_BATCH];
+    const bignum_t *np[MAX_BATCH];
+    uint64_t rem[MAX_BATCH], r_ref;
+    bool ok = true;
+    for (int round = 0; round < 50; ++round) {
+        size_t count = 1 + rng_next() % MAX_BATCH;
+        for (size_t k = 0; k < count; ++k) {
+            bignum_random(&n[k], (int)(rng_next() % (BIGNUM_CAPACITY + 1)));
+            n_copy[k] = n[k];
+            qp[k] = &n[k];
+            np[k] = &n[k];
+        }
+        ok = ok && bignum_div_u64_batch(qp, np, count, 1000000007ull, rem) == BIGNUM_DIV_U64_OK;
+        for (size_t k = 0; ok && k < count; ++k) {
+            bignum_div_u64(&q_ref, &n_copy[k], 1000000007ull, &r_ref);
+            ok = q_ref.len == n[k].len && r_ref == rem[k] &&
+                 memcmp(q_ref.words, n[k].words, sizeof(q_ref.words)) == 0;
+        }
+    }
+    ASSERT_TRUE(ok, "In-place batch (q[k] == n[k]) matches bignum_div_u64");
+}
+
+// --- Тесты на обработку ошибок ---
+
+void test_errors_leave_outputs_untouched() {
+    bignum_t n[3], q[3];
+    bignum_t *qp[3] = { &q[0], &q[1], &q[2] };
+    const bignum_t *np[3] = { &n[0], &n[1], &n[2] };
+    uint64_t rem[3] = { 11, 22, 33 };
+    for (int k = 0; k < 3; ++k) {
+        bignum_random(&n[k], 4);
+        memset(&q[k], 0x77, sizeof(q[k]));
+    }
+
+    ASSERT_TRUE(bignum_div_u64_batch(NULL, np, 3, 7, rem) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL q array");
+    ASSERT_TRUE(bignum_div_u64_batch(qp, NULL, 3, 7, rem) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL n array");
+    ASSERT_TRUE(bignum_div_u64_batch(qp, np, 3, 7, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL rem array");
+    ASSERT_TRUE(bignum_div_u64_batch(qp, np, 3, 0, rem) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Handles division by zero");
+
+    np[2] = NULL;
+    ASSERT_TRUE(bignum_div_u64_batch(qp, np, 3, 7, rem) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL element");
+    np[2] = &n[2];
+
+    n[2].len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_div_u64_batch(qp, np, 3, 7, rem) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Handles bad length of last element");
+    n[2].len = 4;
+
+    qp[1] = (bignum_t *)&n[1].words[1];
+    ASSERT_TRUE(bignum_div_u64_batch(qp, np, 3, 7, rem) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP, "Handles overlapping element");
+    qp[1] = &q[1];
+
+    ASSERT_TRUE(rem[0] == 11 && rem[1] == 22 && rem[2] == 33, "Remainders untouched on error");
+    ASSERT_TRUE(q[0].words[0] == 0x7777777777777777ull, "Quotients untouched on error");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64_batch ===\n");
+
+    RUN_TEST(test_batch_matches_single);
+    RUN_TEST(test_empty_batch);
+    RUN_TEST(test_all_zero_lengths);
+    RUN_TEST(test_in_place_batch);
+    RUN_TEST(test_errors_leave_outputs_untouched);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
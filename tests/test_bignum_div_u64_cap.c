@@ -0,0 +1,176 @@
+/**
+ * @file    test_bignum_div_u64_cap.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты функций фиксированной ёмкости bignum_div_u64_256..8192.
+ *
+ * @details
+ *   Для каждой ёмкости сверяет частное и остаток с эталоном на
+ *   unsigned __int128 на всех длинах, проверяет обнуление хвоста, деление
+ *   на месте и коды ошибок. Проверки порождаются макросом на каждый тип.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+__extension__ typedef unsigned __int128 u128_t;
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x85EBCA77C2B2AE63ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/** Эталонное деление столбиком; возвращает остаток и длину частного. */
+static uint64_t reference_div(uint64_t *q, const uint64_t *n, int len, uint64_t d, int *q_len) {
+    u128_t r = 0;
+    for (int i = len - 1; i >= 0; --i) {
+        u128_t cur = (r << 64) | n[i];
+        q[i] = (uint64_t)(cur / d);
+        r = cur % d;
+    }
+    *q_len = len;
+    while (*q_len > 0 && q[*q_len - 1] == 0) (*q_len)--;
+    return (uint64_t)r;
+}
+
+/** Проверяет, что слова words[from..cap-1] равны нулю. */
+static bool tail_is_zero(const uint64_t *words, int from, int cap) {
+    for (int i = from; i < cap; ++i) {
+        if (words[i] != 0) return false;
+    }
+    return true;
+}
+
+/**
+ * Порождает функции check_<BITS> (сверка с эталоном, в том числе на месте)
+ * и check_errors_<BITS> для типа bignum<BITS>_t ёмкости CAP.
+ */
+#define DEFINE_CAP_CHECKS(BITS, CAP)                                                         \
+    static bool check_##BITS(void) {                                                         \
+        for (int round = 0; round < 12; ++round) {                                           \
+            uint64_t d = (round == 0) ? 1 : (round == 1) ? 0xFFFFFFFFFFFFFFFFull                \
+                       : rng_next() >> (rng_next() % 64);                                    \
+            if (d == 0) d = 5;                                                               \
+            for (int len = 0; len <= CAP; ++len) {                                           \
+                bignum##BITS##_t n, q;                                                       \
+                uint64_t q_ref[CAP], r = 1, r_ref;                                           \
+                int q_len;                                                                   \
+                memset(&n, 0, sizeof(n));                                                    \
+                n.len = len;                                                                 \
+                for (int i = 0; i < len; ++i) n.words[i] = rng_next();                       \
+                if (len > 1 && round % 3 == 2) n.words[len - 1] = 0;                         \
+                memset(&q, 0xA5, sizeof(q));                                                 \
+                r_ref = reference_div(q_ref, n.words, len, d, &q_len);                       \
+                if (bignum_div_u64_##BITS(&q, &n, d, &r) != BIGNUM_DIV_U64_OK) return false; \
+                if (r != r_ref || q.len != q_len) return false;                              \
+                if (memcmp(q.words, q_ref, (size_t)q_len * sizeof(uint64_t)) != 0) return false; \
+                if (!tail_is_zero(q.words, q_len, CAP)) return false;                        \
+                for (int i = len; i < CAP; ++i) n.words[i] = rng_next();                     \
+                if (bignum_div_u64_##BITS(&n, &n, d, &r) != BIGNUM_DIV_U64_OK) return false; \
+                if (r != r_ref || n.len != q_len) return false;                              \
+                if (memcmp(n.words, q_ref, (size_t)q_len * sizeof(uint64_t)) != 0) return false; \
+                if (!tail_is_zero(n.words, q_len, CAP)) return false;                        \
+            }                                                                                \
+        }                                                                                    \
+        return true;                                                                         \
+    }                                                                                        \
+    static bool check_errors_##BITS(void) {                                                  \
+        bignum##BITS##_t pair[2], q;                                                         \
+        uint64_t r;                                                                          \
+        memset(pair, 0, sizeof(pair));                                                       \
+        pair[0].len = 1;                                                                     \
+        pair[0].words[0] = 9;                                                                \
+        if (bignum_div_u64_##BITS(NULL, &pair[0], 3, &r) != BIGNUM_DIV_U64_ERR_NULL_PTR) return false; \
+        if (bignum_div_u64_##BITS(&q, NULL, 3, &r) != BIGNUM_DIV_U64_ERR_NULL_PTR) return false; \
+        if (bignum_div_u64_##BITS(&q, &pair[0], 3, NULL) != BIGNUM_DIV_U64_ERR_NULL_PTR) return false; \
+        if (bignum_div_u64_##BITS(&q, &pair[0], 0, &r) != BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO) return false; \
+        if (bignum_div_u64_##BITS(&pair[1], &pair[0], 3, &r) != BIGNUM_DIV_U64_OK || r != 0) return false; \
+        if (bignum_div_u64_##BITS((bignum##BITS##_t *)&pair[0].words[1], &pair[0], 3, &r)   \
+            != BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP) return false;                             \
+        pair[0].len = CAP + 1;                                                               \
+        if (bignum_div_u64_##BITS(&q, &pair[0], 3, &r) != BIGNUM_DIV_U64_ERR_BAD_LENGTH) return false; \
+        pair[0].len = -1;                                                                    \
+        if (bignum_div_u64_##BITS(&q, &pair[0], 3, &r) != BIGNUM_DIV_U64_ERR_BAD_LENGTH) return false; \
+        return true;                                                                         \
+    }
+
+DEFINE_CAP_CHECKS(256, 4)
+DEFINE_CAP_CHECKS(512, 8)
+DEFINE_CAP_CHECKS(1024, 16)
+DEFINE_CAP_CHECKS(2048, 32)
+DEFINE_CAP_CHECKS(4096, 64)
+DEFINE_CAP_CHECKS(8192, 128)
+
+// --- Тестовые случаи ---
+
+void test_type_layout(void) {
+    ASSERT_TRUE(sizeof(bignum256_t) == 40 && sizeof(bignum8192_t) == 128 * 8 + 8, "Struct sizes are 8 * C + 8");
+    ASSERT_TRUE(sizeof(bignum2048_t) == sizeof(bignum_t), "bignum2048_t matches bignum_t");
+}
+
+void test_division(void) {
+    ASSERT_TRUE(check_256(), "256-bit division matches reference");
+    ASSERT_TRUE(check_512(), "512-bit division matches reference");
+    ASSERT_TRUE(check_1024(), "1024-bit division matches reference");
+    ASSERT_TRUE(check_2048(), "2048-bit division matches reference");
+    ASSERT_TRUE(check_4096(), "4096-bit division matches reference");
+    ASSERT_TRUE(check_8192(), "8192-bit division matches reference");
+}
+
+void test_errors(void) {
+    ASSERT_TRUE(check_errors_256(), "256-bit error codes");
+    ASSERT_TRUE(check_errors_512(), "512-bit error codes");
+    ASSERT_TRUE(check_errors_1024(), "1024-bit error codes");
+    ASSERT_TRUE(check_errors_2048(), "2048-bit error codes");
+    ASSERT_TRUE(check_errors_4096(), "4096-bit error codes");
+    ASSERT_TRUE(check_errors_8192(), "8192-bit error codes");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64 fixed capacities ===\n");
+
+    RUN_TEST(test_type_layout);
+    RUN_TEST(test_division);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,249 @@
+/**
+ * @file    test_bignum_div_u64_dispatch.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты выбора ядра bignum_div_u64 во время выполнения.
+ *
+ * @details
+ *   Проверяет ядро по умолчанию, имена ядер, отказ для неверного номера и
+ *   прогоняет каждое поддерживаемое ядро через публичный bignum_div_u64:
+ *   сравнение с эталонным делением на unsigned __int128, деление на месте
+ *   и обработку ошибок.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ *   - rev. 2 (15.10.2026): Делимые со старшими нулевыми словами.
+ *   - rev. 3 (15.10.2026): Ядро small и маршрутизация малых делителей.
+ *   - rev. 4 (15.10.2026): Ядро shift и маршрутизация степеней двойки.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+__extension__ typedef unsigned __int128 u128_t;
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0xC2B2AE3D27D4EB4Full;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** Эталонное деление столбиком на unsigned __int128. */
+static void reference_div(bignum_t *q, const bignum_t *n, uint64_t d, uint64_t *rem) {
+    u128_t r = 0;
+    memset(q, 0, sizeof(*q));
+    for (int i = n->len - 1; i >= 0; --i) {
+        u128_t cur = (r << 64) | n->words[i];
+        q->words[i] = (uint64_t)(cur / d);
+        r = cur % d;
+    }
+    q->len = n->len;
+    while (q->len > 0 && q->words[q->len - 1] == 0) q->len--;
+    *rem = (uint64_t)r;
+}
+
+/** Сверяет текущее ядро с эталоном на всех длинах, в том числе на месте и со старшими нулями. */
+static bool check_current_kernel(void) {
+    static const uint64_t divisors[] = {
+        1, 2, 3, 10, 0xFFFFFFFFull, 0x100000000ull, 1000000000000000000ull,
+        0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull
+    };
+    for (int round = 0; round < 40; ++round) {
+        uint64_t d = (round < 9) ? divisors[round] : rng_next() >> (rng_next() % 64);
+        if (d == 0) d = 7;
+        for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            bignum_t n, q, q_ref;
+            uint64_t r = 1, r_ref;
+            bignum_random(&n, len);
+            if (round % 4 == 3) {
+                for (int i = len / 2; i < len; ++i) n.words[i] = 0;  // старшие нули
+            }
+            memset(&q, 0xA5, sizeof(q));
+            reference_div(&q_ref, &n, d, &r_ref);
+            if (bignum_div_u64(&q, &n, d, &r) != BIGNUM_DIV_U64_OK) return false;
+            if (q.len != q_ref.len || r != r_ref || memcmp(q.words, q_ref.words, sizeof(q.words)) != 0) return false;
+            if (bignum_div_u64(&n, &n, d, &r) != BIGNUM_DIV_U64_OK) return false;
+            if (n.len != q_ref.len || r != r_ref || memcmp(n.words, q_ref.words, sizeof(n.words)) != 0) return false;
+        }
+    }
+    return true;
+}
+
+/** Проверяет коды ошибок текущего ядра. */
+static bool check_current_kernel_errors(void) {
+    bignum_t n, q;
+    uint64_t r;
+    bignum_random(&n, 3);
+    if (bignum_div_u64(NULL, &n, 3, &r) != BIGNUM_DIV_U64_ERR_NULL_PTR) return false;
+    if (bignum_div_u64(&q, NULL, 3, &r) != BIGNUM_DIV_U64_ERR_NULL_PTR) return false;
+    if (bignum_div_u64(&q, &n, 3, NULL) != BIGNUM_DIV_U64_ERR_NULL_PTR) return false;
+    if (bignum_div_u64(&q, &n, 0, &r) != BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO) return false;
+    if (bignum_div_u64((bignum_t *)&n.words[1], &n, 3, &r) != BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP) return false;
+    if (bignum_div_u64((bignum_t *)&n.words[1], &n, 1ull << 40, &r) != BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP) return false;
+    n.len = BIGNUM_CAPACITY + 1;
+    if (bignum_div_u64(&q, &n, 3, &r) != BIGNUM_DIV_U64_ERR_BAD_LENGTH) return false;
+    n.len = -1;
+    if (bignum_div_u64(&q, &n, 3, &r) != BIGNUM_DIV_U64_ERR_BAD_LENGTH) return false;
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_default_kernel() {
+    bignum_div_u64_kernel_t kernel = bignum_div_u64_get_kernel();
+    ASSERT_TRUE(kernel >= 0 && kernel < BIGNUM_DIV_U64_KERNEL_COUNT, "Default kernel is valid");
+    ASSERT_TRUE(kernel != BIGNUM_DIV_U64_KERNEL_HALF, "Half-limb kernel is not picked by default");
+    printf("    Selected kernel: %s\n", bignum_div_u64_kernel_name(kernel));
+}
+
+void test_default_routing() {
+    bignum_div_u64_kernel_t kernel = bignum_div_u64_get_kernel();
+    bool consistent = true;
+    static const uint64_t divisors[] = {3, 10, 0xFFFFFFFFull, 0x100000001ull, 0xFFFFFFFFFFFFFFFFull};
+    for (size_t i = 0; i < sizeof(divisors) / sizeof(divisors[0]); ++i) {
+        bool small_d = divisors[i] <= 0xFFFFFFFFull;
+        for (size_t len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            bignum_div_u64_kernel_t k = bignum_div_u64_kernel_for(len, divisors[i]);
+            if (k != kernel && !(small_d && k == BIGNUM_DIV_U64_KERNEL_SMALL)) consistent = false;
+            // Маршрут монотонен по длине: длинные делимые не возвращаются к ядру по умолчанию
+            if (len > 0 && bignum_div_u64_kernel_for(len - 1, divisors[i]) == BIGNUM_DIV_U64_KERNEL_SMALL &&
+                k != BIGNUM_DIV_U64_KERNEL_SMALL) consistent = false;
+        }
+    }
+    ASSERT_TRUE(consistent, "Only d < 2^32 is routed to the small kernel");
+    printf("    Small kernel from len: ");
+    size_t len = 0;
+    while (len <= BIGNUM_CAPACITY && bignum_div_u64_kernel_for(len, 3) != BIGNUM_DIV_U64_KERNEL_SMALL) ++len;
+    if (len > BIGNUM_CAPACITY) printf("never\n"); else printf("%zu\n", len);
+    ASSERT_TRUE(check_current_kernel(), "Default routing matches reference division");
+    ASSERT_TRUE(check_current_kernel_errors(), "Default routing reports errors");
+    ASSERT_TRUE(bignum_div_u64_get_kernel() == kernel, "Routing does not change the reported kernel");
+}
+
+void test_power_of_two_routing() {
+    bool routed = true, matches = true;
+    for (int k = 0; k < 64; ++k) {
+        uint64_t d = 1ull << k;
+        for (size_t len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            if (bignum_div_u64_kernel_for(len, d) != BIGNUM_DIV_U64_KERNEL_SHIFT) routed = false;
+        }
+        for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            bignum_t n, q, q_ref;
+            uint64_t r = 1, r_ref;
+            bignum_random(&n, len);
+            if (k % 3 == 2) {
+                for (int i = len / 2; i < len; ++i) n.words[i] = 0;  // старшие нули
+            }
+            memset(&q, 0xA5, sizeof(q));
+            reference_div(&q_ref, &n, d, &r_ref);
+            if (bignum_div_u64(&q, &n, d, &r) != BIGNUM_DIV_U64_OK ||
+                q.len != q_ref.len || r != r_ref || memcmp(q.words, q_ref.words, sizeof(q.words)) != 0) matches = false;
+            if (bignum_div_u64(&n, &n, d, &r) != BIGNUM_DIV_U64_OK ||
+                n.len != q_ref.len || r != r_ref || memcmp(n.words, q_ref.words, sizeof(n.words)) != 0) matches = false;
+        }
+    }
+    ASSERT_TRUE(routed, "Every d = 2^k is routed to the shift kernel");
+    ASSERT_TRUE(matches, "Shift routing matches reference division, in place too");
+    bignum_t n, q;
+    uint64_t r;
+    bignum_random(&n, 3);
+    ASSERT_TRUE(bignum_div_u64(&q, &n, 0, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Zero divisor still reported");
+    ASSERT_TRUE(bignum_div_u64((bignum_t *)&n.words[1], &n, 8, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP,
+                "Partial overlap reported for d = 2^k");
+}
+
+void test_kernel_names() {
+    ASSERT_TRUE(strcmp(bignum_div_u64_kernel_name(BIGNUM_DIV_U64_KERNEL_HWDIV), "hwdiv") == 0 &&
+                strcmp(bignum_div_u64_kernel_name(BIGNUM_DIV_U64_KERNEL_PREINV), "preinv") == 0 &&
+                strcmp(bignum_div_u64_kernel_name(BIGNUM_DIV_U64_KERNEL_MULX), "mulx") == 0 &&
+                strcmp(bignum_div_u64_kernel_name(BIGNUM_DIV_U64_KERNEL_HALF), "half") == 0 &&
+                strcmp(bignum_div_u64_kernel_name(BIGNUM_DIV_U64_KERNEL_SMALL), "small") == 0 &&
+                strcmp(bignum_div_u64_kernel_name(BIGNUM_DIV_U64_KERNEL_SHIFT), "shift") == 0,
+                "Kernel names");
+    ASSERT_TRUE(strcmp(bignum_div_u64_kernel_name(BIGNUM_DIV_U64_KERNEL_COUNT), "unknown") == 0, "Unknown kernel name");
+}
+
+void test_every_kernel() {
+    bignum_div_u64_kernel_t saved = bignum_div_u64_get_kernel();
+    for (int k = 0; k < BIGNUM_DIV_U64_KERNEL_COUNT; ++k) {
+        char message[96];
+        bignum_div_u64_status_t status = bignum_div_u64_set_kernel((bignum_div_u64_kernel_t)k);
+        if (status == BIGNUM_DIV_U64_ERR_UNSUPPORTED) {
+            printf("    Kernel %s is not supported on this CPU\n", bignum_div_u64_kernel_name((bignum_div_u64_kernel_t)k));
+            ASSERT_TRUE(k == BIGNUM_DIV_U64_KERNEL_MULX, "Only the mulx kernel may be unsupported");
+            continue;
+        }
+        ASSERT_TRUE(status == BIGNUM_DIV_U64_OK && bignum_div_u64_get_kernel() == (bignum_div_u64_kernel_t)k,
+                    "Kernel is installed");
+        snprintf(message, sizeof(message), "Kernel %s matches reference division",
+                 bignum_div_u64_kernel_name((bignum_div_u64_kernel_t)k));
+        ASSERT_TRUE(check_current_kernel(), message);
+        snprintf(message, sizeof(message), "Kernel %s reports errors",
+                 bignum_div_u64_kernel_name((bignum_div_u64_kernel_t)k));
+        ASSERT_TRUE(check_current_kernel_errors(), message);
+    }
+    ASSERT_TRUE(bignum_div_u64_set_kernel(saved) == BIGNUM_DIV_U64_OK, "Default kernel restored");
+}
+
+void test_invalid_kernel() {
+    bignum_div_u64_kernel_t saved = bignum_div_u64_get_kernel();
+    ASSERT_TRUE(bignum_div_u64_set_kernel(BIGNUM_DIV_U64_KERNEL_COUNT) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "Rejects out-of-range kernel");
+    ASSERT_TRUE(bignum_div_u64_set_kernel((bignum_div_u64_kernel_t)-1) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "Rejects negative kernel");
+    ASSERT_TRUE(bignum_div_u64_get_kernel() == saved, "Kernel unchanged after rejection");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64 kernel dispatch ===\n");
+
+    RUN_TEST(test_default_kernel);
+    RUN_TEST(test_default_routing);
+    RUN_TEST(test_power_of_two_routing);
+    RUN_TEST(test_kernel_names);
+    RUN_TEST(test_every_kernel);
+    RUN_TEST(test_invalid_kernel);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file    test_bignum_div_u64_divexact.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief   Тесты для функции bignum_divexact_u64.
+ *
+ * @details
+ *   Делит произведения q * d на d для нечётных, чётных, малых и больших
+ *   делителей и степеней двойки на всех длинах, в том числе на месте, и
+ *   сверяет результат с исходным q и с bignum_div_u64 (частное, длина,
+ *   нулевой хвост). Также проверяются коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0xD1B54A32D192ED03ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** p = a * d; возвращает false, если произведение не помещается в bignum_t. */
+static bool bignum_mul_u64(bignum_t *p, const bignum_t *a, uint64_t d) {
+    __extension__ typedef unsigned __int128 u128_t;
+    uint64_t carry = 0;
+    memset(p, 0, sizeof(*p));
+    for (int i = 0; i < a->len; ++i) {
+        u128_t t = (u128_t)a->words[i] * d + carry;
+        p->words[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
+    int len = a->len;
+    if (carry != 0) {
+        if (len == BIGNUM_CAPACITY) return false;
+        p->words[len++] = carry;
+    }
+    while (len > 0 && p->words[len - 1] == 0) --len;
+    p->len = len;
+    return true;
+}
+
+static const size_t COMPARED_BYTES = offsetof(bignum_t, len) + sizeof(int32_t);
+
+/** Проверяет bignum_divexact_u64 на произведениях a * d для всех длин a. */
+static bool divides_products(uint64_t d) {
+    for (int len = 0; len < BIGNUM_CAPACITY; ++len) {
+        for (int round = 0; round < 3; ++round) {
+            bignum_t a, n, q, q_ref;
+            uint64_t r_ref;
+            bignum_random(&a, len);
+            if (round == 1) memset(a.words, 0xFF, sizeof(uint64_t) * (size_t)len);
+            while (a.len > 0 && a.words[a.len - 1] == 0) --a.len;
+            if (!bignum_mul_u64(&n, &a, d)) return false;
+            memset(&q, 0xA5, sizeof(q));
+            if (bignum_divexact_u64(&q, &n, d) != BIGNUM_DIV_U64_OK) return false;
+            if (memcmp(&q, &a, COMPARED_BYTES) != 0) return false;
+            if (bignum_div_u64(&q_ref, &n, d, &r_ref) != BIGNUM_DIV_U64_OK || r_ref != 0) return false;
+            if (memcmp(&q, &q_ref, COMPARED_BYTES) != 0) return false;
+            if (bignum_divexact_u64(&n, &n, d) != BIGNUM_DIV_U64_OK) return false;
+            if (memcmp(&n, &a, COMPARED_BYTES) != 0) return false;
+        }
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_odd_divisors(void) {
+    ASSERT_TRUE(divides_products(1), "d = 1");
+    ASSERT_TRUE(divides_products(3), "d = 3");
+    ASSERT_TRUE(divides_products(1000000007), "d = 10^9 + 7");
+    ASSERT_TRUE(divides_products(0xFFFFFFFFFFFFFFFFull), "d = 2^64 - 1");
+    bool ok = true;
+    for (int i = 0; i < 64 && ok; ++i) ok = divides_products(rng_next() | 1);
+    ASSERT_TRUE(ok, "Random odd divisors");
+}
+
+void test_even_divisors(void) {
+    ASSERT_TRUE(divides_products(10), "d = 10");
+    ASSERT_TRUE(divides_products(0x8000000000000000ull), "d = 2^63");
+    ASSERT_TRUE(divides_products(4096), "d = 2^12");
+    ASSERT_TRUE(divides_products(10000000000000000000ull), "d = 10^19");
+    bool ok = true;
+    for (int i = 0; i < 64 && ok; ++i) {
+        uint64_t d = (rng_next() | 1) << (i % 63);
+        ok = divides_products(d);
+    }
+    ASSERT_TRUE(ok, "Random even divisors");
+}
+
+void test_errors(void) {
+    bignum_t n, q;
+    bignum_random(&n, 2);
+    ASSERT_TRUE(bignum_divexact_u64(NULL, &n, 3) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL q");
+    ASSERT_TRUE(bignum_divexact_u64(&q, NULL, 3) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_divexact_u64(&q, &n, 0) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Division by zero");
+    bignum_t pair[2];
+    pair[0] = n;
+    ASSERT_TRUE(bignum_divexact_u64((bignum_t *)&pair[0].words[1], &pair[0], 3) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP,
+                "Partial overlap");
+    n.len = -1;
+    ASSERT_TRUE(bignum_divexact_u64(&q, &n, 3) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_divexact_u64(&q, &n, 3) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_divexact_u64 ===\n");
+
+    RUN_TEST(test_odd_divisors);
+    RUN_TEST(test_even_divisors);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
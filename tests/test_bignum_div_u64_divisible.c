@@ -0,0 +1,204 @@
+/**
+ * @file    test_bignum_div_u64_divisible.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief   Тесты для функций bignum_divisible_u64 и bignum_divisible_u64_multi.
+ *
+ * @details
+ *   Сверяет ответ с bignum_mod_u64 на кратных делителю числах, на соседних
+ *   с ними, на кратных только нечётной части делителя и на случайных
+ *   числах всех длин, а также пакетный вариант с одиночным для разного
+ *   числа делителей. Также проверяются коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x94D049BB133111EBull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** n -= n mod d (n становится кратным d). */
+static void make_multiple(bignum_t *n, uint64_t d) {
+    uint64_t rem;
+    bignum_mod_u64(n, d, &rem);
+    for (int i = 0; i < n->len && rem != 0; ++i) {
+        uint64_t w = n->words[i];
+        n->words[i] = w - rem;
+        rem = w < rem;
+    }
+    while (n->len > 0 && n->words[n->len - 1] == 0) --n->len;
+}
+
+/** Сравнивает bignum_divisible_u64(n, d) с bignum_mod_u64(n, d) == 0. */
+static bool matches_mod(const bignum_t *n, uint64_t d) {
+    uint64_t rem;
+    if (bignum_mod_u64(n, d, &rem) != BIGNUM_DIV_U64_OK) return false;
+    bool divisible = (rem != 0);  // противоположный ответ: результат должен быть записан
+    if (bignum_divisible_u64(n, d, &divisible) != BIGNUM_DIV_U64_OK) return false;
+    return divisible == (rem == 0);
+}
+
+/** Проверяет делитель d на случайных, кратных и соседних с кратными числах всех длин. */
+static bool check_divisor(uint64_t d) {
+    uint64_t odd = d >> __builtin_ctzll(d);
+    for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+        bignum_t n;
+        bignum_random(&n, len);
+        if (!matches_mod(&n, d)) return false;
+        make_multiple(&n, d);
+        if (!matches_mod(&n, d)) return false;
+        if (len > 0) {
+            n.words[0] ^= 1;  // соседнее с кратным
+            if (!matches_mod(&n, d)) return false;
+        }
+        bignum_random(&n, len);
+        make_multiple(&n, odd);  // кратно только нечётной части
+        if (!matches_mod(&n, d)) return false;
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_fixed_divisors(void) {
+    ASSERT_TRUE(check_divisor(1), "d = 1");
+    ASSERT_TRUE(check_divisor(2), "d = 2");
+    ASSERT_TRUE(check_divisor(3), "d = 3");
+    ASSERT_TRUE(check_divisor(0x8000000000000000ull), "d = 2^63");
+    ASSERT_TRUE(check_divisor(1000000007), "d = 10^9 + 7");
+    ASSERT_TRUE(check_divisor(10000000000000000000ull), "d = 10^19");
+    ASSERT_TRUE(check_divisor(0xFFFFFFFFFFFFFFFFull), "d = 2^64 - 1");
+}
+
+void test_random_divisors(void) {
+    bool ok = true;
+    for (int i = 0; i < 256 && ok; ++i) {
+        uint64_t d = rng_next() >> (i % 64);
+        ok = check_divisor(d == 0 ? 7 : d);
+    }
+    ASSERT_TRUE(ok, "Random divisors of every size");
+}
+
+void test_small_values(void) {
+    bool ok = true;
+    for (uint64_t w = 0; w < 200 && ok; ++w) {
+        for (uint64_t d = 1; d < 40 && ok; ++d) {
+            bignum_t n;
+            bignum_random(&n, 1);
+            n.words[0] = w;
+            n.len = w ? 1 : 0;
+            bool divisible = false;
+            ok = bignum_divisible_u64(&n, d, &divisible) == BIGNUM_DIV_U64_OK && divisible == (w % d == 0);
+        }
+    }
+    ASSERT_TRUE(ok, "Single-word values against the % operator");
+}
+
+void test_multi(void) {
+    uint64_t d[100];
+    bool expected[100], divisible[100];
+    bool ok = true;
+    for (int round = 0; round < 32 && ok; ++round) {
+        bignum_t n;
+        bignum_random(&n, round % (BIGNUM_CAPACITY + 1));
+        for (int j = 0; j < 100; ++j) {
+            d[j] = rng_next() >> (rng_next() % 64);
+            if (d[j] == 0) d[j] = 1;
+            if (j % 3 == 0) d[j] = (uint64_t)(j / 3 + 1);  // малые, часто делят n
+        }
+        make_multiple(&n, d[1]);
+        const size_t counts[] = {0, 1, 31, 32, 33, 100};
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]) && ok; ++c) {
+            size_t k = counts[c];
+            memset(divisible, 0xA5, sizeof(divisible));
+            for (size_t j = 0; j < k; ++j) bignum_divisible_u64(&n, d[j], &expected[j]);
+            if (bignum_divisible_u64_multi(&n, d, k, divisible) != BIGNUM_DIV_U64_OK) ok = false;
+            for (size_t j = 0; j < k; ++j) {
+                if (divisible[j] != expected[j]) ok = false;
+            }
+            if (k < 100 && ((const unsigned char *)divisible)[k] != 0xA5) ok = false;
+        }
+    }
+    ASSERT_TRUE(ok, "Batch matches single tests for 0, 1, 31, 32, 33 and 100 divisors");
+}
+
+void test_errors(void) {
+    bignum_t n;
+    bool divisible = true, many[2] = {true, true};
+    uint64_t d[2] = {3, 0};
+    bignum_random(&n, 2);
+    ASSERT_TRUE(bignum_divisible_u64(NULL, 3, &divisible) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_divisible_u64(&n, 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL divisible");
+    ASSERT_TRUE(bignum_divisible_u64(&n, 0, &divisible) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Division by zero");
+    ASSERT_TRUE(bignum_divisible_u64_multi(NULL, d, 1, many) == BIGNUM_DIV_U64_ERR_NULL_PTR, "multi: NULL n");
+    ASSERT_TRUE(bignum_divisible_u64_multi(&n, NULL, 1, many) == BIGNUM_DIV_U64_ERR_NULL_PTR, "multi: NULL d");
+    ASSERT_TRUE(bignum_divisible_u64_multi(&n, d, 1, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "multi: NULL divisible");
+    ASSERT_TRUE(bignum_divisible_u64_multi(&n, d, 2, many) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO && many[0] && many[1],
+                "multi: zero divisor, nothing written");
+    n.len = -1;
+    ASSERT_TRUE(bignum_divisible_u64(&n, 3, &divisible) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Negative length");
+    ASSERT_TRUE(bignum_divisible_u64_multi(&n, d, 1, many) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "multi: negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_divisible_u64(&n, 3, &divisible) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_divisible_u64 ===\n");
+
+    RUN_TEST(test_fixed_divisors);
+    RUN_TEST(test_random_divisors);
+    RUN_TEST(test_small_values);
+    RUN_TEST(test_multi);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file    test_bignum_div_u64_ex.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты для функции bignum_div_u64_ex.
+ *
+ * @details
+ *   Проверяет, что без флагов результат совпадает с bignum_div_u64, и
+ *   действие каждого флага: хвост q не трогается, rem может быть NULL,
+ *   q->len = n->len. Также проверяются коды ошибок и неизвестные флаги.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define GUARD 0xA5A5A5A5A5A5A5A5ull
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x94D049BB133111EBull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** Сверяет bignum_div_u64_ex(flags) с bignum_div_u64 на всех длинах. */
+static bool check_flags(unsigned flags) {
+    for (int round = 0; round < 20; ++round) {
+        uint64_t d = rng_next() >> (rng_next() % 64);
+        if (d == 0) d = 17;
+        for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            bignum_t n, q, q_ref;
+            uint64_t r = 1, r_ref;
+            bignum_random(&n, len);
+            if (len > 0 && round % 2) n.words[len - 1] = 0;  // частное со старшим нулём
+            for (int i = 0; i < BIGNUM_CAPACITY; ++i) q.words[i] = GUARD;
+            if (bignum_div_u64(&q_ref, &n, d, &r_ref) != BIGNUM_DIV_U64_OK) return false;
+            uint64_t *rp = (flags & BIGNUM_DIV_U64_FLAG_REM_OPTIONAL) ? NULL : &r;
+            if (bignum_div_u64_ex(&q, &n, d, rp, flags) != BIGNUM_DIV_U64_OK) return false;
+            if (rp && r != r_ref) return false;
+            int expected_len = (flags & BIGNUM_DIV_U64_FLAG_NO_NORMALIZE) ? len : q_ref.len;
+            if (q.len != expected_len) return false;
+            if (memcmp(q.words, q_ref.words, (size_t)len * sizeof(uint64_t)) != 0) return false;
+            for (int i = len; i < BIGNUM_CAPACITY; ++i) {
+                uint64_t expected = (flags & BIGNUM_DIV_U64_FLAG_NO_TAIL_CLEAR) ? GUARD : 0;
+                if (q.words[i] != expected) return false;
+            }
+        }
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_no_flags(void) {
+    ASSERT_TRUE(check_flags(BIGNUM_DIV_U64_FLAG_NONE), "No flags matches bignum_div_u64");
+}
+
+void test_each_flag(void) {
+    ASSERT_TRUE(check_flags(BIGNUM_DIV_U64_FLAG_NO_TAIL_CLEAR), "NO_TAIL_CLEAR leaves the tail untouched");
+    ASSERT_TRUE(check_flags(BIGNUM_DIV_U64_FLAG_REM_OPTIONAL), "REM_OPTIONAL accepts NULL rem");
+    ASSERT_TRUE(check_flags(BIGNUM_DIV_U64_FLAG_NO_NORMALIZE), "NO_NORMALIZE sets q->len = n->len");
+    ASSERT_TRUE(check_flags(BIGNUM_DIV_U64_FLAG_NO_TAIL_CLEAR | BIGNUM_DIV_U64_FLAG_REM_OPTIONAL |
+                            BIGNUM_DIV_U64_FLAG_NO_NORMALIZE), "All flags combined");
+}
+
+void test_in_place(void) {
+    bignum_t n, q_ref;
+    uint64_t r, r_ref;
+    bignum_random(&n, 5);
+    n.words[10] = 77;  // мусор за n->len
+    n.words[4] = 1;
+    bignum_div_u64(&q_ref, &n, 1000, &r_ref);
+    bignum_div_u64_status_t s = bignum_div_u64_ex(&n, &n, 1000, &r, BIGNUM_DIV_U64_FLAG_NO_TAIL_CLEAR);
+    ASSERT_TRUE(s == BIGNUM_DIV_U64_OK && r == r_ref && n.len == q_ref.len, "In-place division with NO_TAIL_CLEAR");
+    ASSERT_TRUE(memcmp(n.words, q_ref.words, 5 * sizeof(uint64_t)) == 0 && n.words[10] == 77,
+                "Quotient written, words past n->len untouched");
+}
+
+void test_errors(void) {
+    bignum_t pair[2], q;
+    uint64_t r;
+    bignum_random(&pair[0], 3);
+    ASSERT_TRUE(bignum_div_u64_ex(&q, &pair[0], 3, NULL, 0) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL rem without REM_OPTIONAL");
+    ASSERT_TRUE(bignum_div_u64_ex(NULL, &pair[0], 3, &r, BIGNUM_DIV_U64_FLAG_REM_OPTIONAL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL q");
+    ASSERT_TRUE(bignum_div_u64_ex(&q, NULL, 3, &r, 0) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_div_u64_ex(&q, &pair[0], 0, &r, 0) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Division by zero");
+    ASSERT_TRUE(bignum_div_u64_ex((bignum_t *)&pair[0].words[1], &pair[0], 3, &r, 0) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP,
+                "Partial overlap");
+    ASSERT_TRUE(bignum_div_u64_ex(&q, &pair[0], 3, &r, 8) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "Unknown flag bit");
+    pair[0].len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_div_u64_ex(&q, &pair[0], 3, &r, 0) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Bad length");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64_ex ===\n");
+
+    RUN_TEST(test_no_flags);
+    RUN_TEST(test_each_flag);
+    RUN_TEST(test_in_place);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -19,6 +19,7 @@
  *   - rev. 1 (08.08.2025) v0.0.1: Создание тестов на робастность.
  *   - rev. 2 (08.08.2025) v0.0.1: Усиление покрытия по результатам ревью.
  *   - rev. 1 (08.08.2025) v0.0.2: Адаптирован для тестирования версии 0.0.2.
+ *   - rev. 2 (15.10.2026): Полное совпадение q и n — деление на месте, а не ошибка.
  */
 
 #include "bignum_div_u64.h"
@@ -77,7 +78,8 @@ void test_robustness_full_buffer_overlap() {
     bignum_t n;
     uint64_t r;
     bignum_from_u64(&n, 123);
-    ASSERT_TRUE(bignum_div_u64(&n, &n, 1, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP, "Handles full buffer overlap");
+    ASSERT_TRUE(bignum_div_u64(&n, &n, 1, &r) == BIGNUM_DIV_U64_OK, "Full buffer overlap divides in place");
+    ASSERT_TRUE(n.len == 1 && n.words[0] == 123 && r == 0, "In-place result is correct");
 }
 
 void test_robustness_partial_buffer_overlap() {
@@ -0,0 +1,154 @@
+/**
+ * @file    test_bignum_div_u64_hpp.cpp
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты для C++-обёртки bignum::div_by<D>.
+ *
+ * @details
+ *   Сверяет div_by<D> с bignum_div_u64 для делителей всех трёх вариантов
+ *   цикла (степень двойки, D < 2^32, D >= 2^32): частное, длина, нулевой
+ *   хвост, остаток, деление на месте; а также коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.hpp"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t rng_next() {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+static const size_t COMPARED_BYTES = offsetof(bignum_t, len) + sizeof(int32_t);
+
+/** Сравнивает div_by<D> с bignum_div_u64 на всех длинах, в том числе на месте. */
+template <uint64_t D>
+static bool matches_library() {
+    for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+        for (int round = 0; round < 8; ++round) {
+            bignum_t n, q, q_ref;
+            uint64_t r = 1, r_ref = 2;
+            bignum_random(&n, len);
+            if (round == 1 && len > 0) n.words[len - 1] = 0;                 // старший ноль
+            if (round == 2 && len > 0) n.words[len - 1] = D - 1;             // частное короче делимого
+            if (round == 3) for (int i = 0; i < len; ++i) n.words[i] = ~0ull;
+            memset(&q, 0xA5, sizeof(q));
+            memset(&q_ref, 0x5A, sizeof(q_ref));
+            if (bignum_div_u64(&q_ref, &n, D, &r_ref) != BIGNUM_DIV_U64_OK) return false;
+            if (bignum::div_by<D>(&q, &n, &r) != BIGNUM_DIV_U64_OK) return false;
+            if (r != r_ref || memcmp(&q, &q_ref, COMPARED_BYTES) != 0) return false;
+            if (bignum::div_by<D>(&n, &n, &r) != BIGNUM_DIV_U64_OK) return false;
+            if (r != r_ref || memcmp(&n, &q_ref, COMPARED_BYTES) != 0) return false;
+        }
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_power_of_two() {
+    ASSERT_TRUE(matches_library<1>(), "D = 1");
+    ASSERT_TRUE(matches_library<2>(), "D = 2");
+    ASSERT_TRUE(matches_library<4096>(), "D = 2^12");
+    ASSERT_TRUE(matches_library<0x8000000000000000ull>(), "D = 2^63");
+}
+
+void test_small_divisors() {
+    ASSERT_TRUE(matches_library<3>(), "D = 3");
+    ASSERT_TRUE(matches_library<10>(), "D = 10");
+    ASSERT_TRUE(matches_library<60>(), "D = 60 (even)");
+    ASSERT_TRUE(matches_library<86400>(), "D = 86400");
+    ASSERT_TRUE(matches_library<1000000000>(), "D = 10^9");
+    ASSERT_TRUE(matches_library<0xFFFFFFFFull>(), "D = 2^32 - 1");
+}
+
+void test_large_divisors() {
+    ASSERT_TRUE(matches_library<0x100000001ull>(), "D = 2^32 + 1");
+    ASSERT_TRUE(matches_library<1000000000000000000ull>(), "D = 10^18");
+    ASSERT_TRUE(matches_library<10000000000000000000ull>(), "D = 10^19 (normalized)");
+    ASSERT_TRUE(matches_library<0xFFFFFFFFFFFFFFFFull>(), "D = 2^64 - 1");
+}
+
+void test_without_remainder() {
+    bignum_t n, q, q_ref;
+    uint64_t r_ref;
+    bignum_random(&n, BIGNUM_CAPACITY);
+    bignum_div_u64(&q_ref, &n, 1000, &r_ref);
+    bignum_div_u64_status_t s = bignum::div_by<1000>(&q, &n);
+    ASSERT_TRUE(s == BIGNUM_DIV_U64_OK && memcmp(&q, &q_ref, COMPARED_BYTES) == 0, "div_by<D>(q, n) without remainder");
+}
+
+void test_errors() {
+    bignum_t n, q;
+    uint64_t r;
+    bignum_random(&n, 2);
+    ASSERT_TRUE(bignum::div_by<3>(nullptr, &n, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL q");
+    ASSERT_TRUE(bignum::div_by<3>(&q, nullptr, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum::div_by<3>(&q, &n, nullptr) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL rem");
+    bignum_t pair[2];
+    pair[0] = n;
+    ASSERT_TRUE(bignum::div_by<3>(reinterpret_cast<bignum_t *>(&pair[0].words[1]), &pair[0], &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP,
+                "Partial overlap");
+    n.len = -1;
+    ASSERT_TRUE(bignum::div_by<3>(&q, &n, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum::div_by<3>(&q, &n, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum::div_by ===\n");
+
+    RUN_TEST(test_power_of_two);
+    RUN_TEST(test_small_divisors);
+    RUN_TEST(test_large_divisors);
+    RUN_TEST(test_without_remainder);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,148 @@
+/**
+ * @file    test_bignum_div_u64_inline.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты для встраиваемой функции bignum_div_u64_inline.
+ *
+ * @details
+ *   Сверяет быстрый путь (n->len <= 2) и резервный вызов с bignum_div_u64:
+ *   частное, длина, нулевой хвост, остаток, деление на месте, деление на
+ *   константу и коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0xD6E8FEB86659FD93ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** Сравнивает bignum_div_u64_inline с bignum_div_u64 для n и d, в том числе на месте. */
+static bool matches_out_of_line(const bignum_t *n, uint64_t d) {
+    bignum_t q_inline, q_ref, n_copy;
+    uint64_t r_inline = 1, r_ref = 2;
+    memset(&q_inline, 0xA5, sizeof(q_inline));
+    memset(&q_ref, 0x5A, sizeof(q_ref));
+    if (bignum_div_u64_inline(&q_inline, n, d, &r_inline) != bignum_div_u64(&q_ref, n, d, &r_ref)) return false;
+    if (r_inline != r_ref || memcmp(&q_inline, &q_ref, offsetof(bignum_t, len) + sizeof(int32_t)) != 0) return false;
+    n_copy = *n;
+    if (bignum_div_u64_inline(&n_copy, &n_copy, d, &r_inline) != BIGNUM_DIV_U64_OK) return false;
+    return r_inline == r_ref && memcmp(&n_copy, &q_ref, offsetof(bignum_t, len) + sizeof(int32_t)) == 0;
+}
+
+// --- Тестовые случаи ---
+
+void test_short_dividends(void) {
+    static const uint64_t divisors[] = {1, 2, 3, 10, 0xFFFFFFFFull, 0x100000000ull, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull};
+    bool ok = true;
+    for (int len = 0; len <= 2; ++len) {
+        for (int round = 0; round < 200; ++round) {
+            bignum_t n;
+            uint64_t d = (round < 8) ? divisors[round] : rng_next() >> (rng_next() % 64);
+            if (d == 0) d = 11;
+            bignum_random(&n, len);
+            if (round % 5 == 4 && len > 0) n.words[len - 1] = 0;  // старший ноль
+            if (!matches_out_of_line(&n, d)) ok = false;
+        }
+    }
+    ASSERT_TRUE(ok, "len <= 2 matches bignum_div_u64 (q, q->len, tail, rem, in place)");
+}
+
+void test_constant_divisor(void) {
+    bignum_t n, q;
+    uint64_t r;
+    bignum_random(&n, 2);
+    n.words[1] = 123456789;
+    n.words[0] = 987654321;
+    bignum_div_u64_status_t s = bignum_div_u64_inline(&q, &n, 10, &r);
+    ASSERT_TRUE(s == BIGNUM_DIV_U64_OK && r == 5, "Division by constant 10: remainder");  // 9 * 2^64 + 987654321 = 5 (mod 10)
+    ASSERT_TRUE(q.len == 2 && q.words[1] == 12345678 &&
+                q.words[0] == (uint64_t)(((__extension__ (unsigned __int128)9 << 64) | 987654321u) / 10),
+                "Division by constant 10: quotient");
+}
+
+void test_fallback(void) {
+    bool ok = true;
+    for (int len = 3; len <= BIGNUM_CAPACITY; ++len) {
+        bignum_t n;
+        bignum_random(&n, len);
+        if (!matches_out_of_line(&n, rng_next() | 1)) ok = false;
+    }
+    ASSERT_TRUE(ok, "Longer dividends fall back to bignum_div_u64");
+}
+
+void test_errors(void) {
+    bignum_t n, q;
+    uint64_t r;
+    bignum_random(&n, 2);
+    ASSERT_TRUE(bignum_div_u64_inline(NULL, &n, 3, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL q");
+    ASSERT_TRUE(bignum_div_u64_inline(&q, NULL, 3, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_div_u64_inline(&q, &n, 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL rem");
+    ASSERT_TRUE(bignum_div_u64_inline(&q, &n, 0, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Division by zero");
+    bignum_t pair[2];
+    pair[0] = n;
+    ASSERT_TRUE(bignum_div_u64_inline((bignum_t *)&pair[0].words[1], &pair[0], 3, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP, "Partial overlap");
+    n.len = -1;
+    ASSERT_TRUE(bignum_div_u64_inline(&q, &n, 3, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_div_u64_inline(&q, &n, 3, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64_inline ===\n");
+
+    RUN_TEST(test_short_dividends);
+    RUN_TEST(test_constant_divisor);
+    RUN_TEST(test_fallback);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
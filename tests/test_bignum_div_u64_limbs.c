@@ -0,0 +1,164 @@
+/**
+ * @file    test_bignum_div_u64_limbs.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты для функции bignum_div_u64_limbs.
+ *
+ * @details
+ *   Сверяет деление массивов до 1024 слов (64K бит) с эталоном на
+ *   unsigned __int128, проверяет деление на месте, отсутствие записи за
+ *   пределами q[len-1], совпадение с bignum_div_u64 и коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+__extension__ typedef unsigned __int128 u128_t;
+
+#define MAX_LIMBS 1024
+#define GUARD     0xA5A5A5A5A5A5A5A5ull
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x27D4EB2F165667C5ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/** Эталонное деление столбиком на unsigned __int128. */
+static uint64_t reference_div(uint64_t *q, const uint64_t *n, size_t len, uint64_t d) {
+    u128_t r = 0;
+    for (size_t i = len; i-- > 0;) {
+        u128_t cur = (r << 64) | n[i];
+        q[i] = (uint64_t)(cur / d);
+        r = cur % d;
+    }
+    return (uint64_t)r;
+}
+
+static uint64_t n_buf[MAX_LIMBS];
+static uint64_t q_buf[MAX_LIMBS + 2];
+static uint64_t q_ref[MAX_LIMBS];
+
+// --- Тестовые случаи ---
+
+void test_random_lengths(void) {
+    static const size_t lens[] = {1, 2, 3, 31, 32, 33, 127, 128, 129, 512, 1024};
+    static const uint64_t divisors[] = {1, 3, 10, 0xFFFFFFFFull, 0x100000000ull, 0x8000000000000000ull, 0xFFFFFFFFFFFFFFFFull};
+    bool ok = true, guard_ok = true;
+    for (size_t li = 0; li < sizeof(lens) / sizeof(lens[0]); ++li) {
+        size_t len = lens[li];
+        for (size_t di = 0; di < sizeof(divisors) / sizeof(divisors[0]) + 4; ++di) {
+            uint64_t d = di < sizeof(divisors) / sizeof(divisors[0]) ? divisors[di] : (rng_next() >> (rng_next() % 64)) | 1;
+            uint64_t r = 1, r_ref;
+            for (size_t i = 0; i < len; ++i) n_buf[i] = rng_next();
+            for (size_t i = 0; i < len + 2; ++i) q_buf[i] = GUARD;
+            r_ref = reference_div(q_ref, n_buf, len, d);
+            if (bignum_div_u64_limbs(q_buf + 1, n_buf, len, d, &r) != BIGNUM_DIV_U64_OK) ok = false;
+            if (r != r_ref || memcmp(q_buf + 1, q_ref, len * sizeof(uint64_t)) != 0) ok = false;
+            if (q_buf[0] != GUARD || q_buf[len + 1] != GUARD) guard_ok = false;
+        }
+    }
+    ASSERT_TRUE(ok, "Quotient and remainder match reference up to 1024 limbs");
+    ASSERT_TRUE(guard_ok, "Nothing written outside q[0..len-1]");
+}
+
+void test_high_zero_limbs(void) {
+    uint64_t n[3] = {5, 0, 0}, q[3] = {GUARD, GUARD, GUARD}, r;
+    bignum_div_u64_status_t s = bignum_div_u64_limbs(q, n, 3, 2, &r);
+    ASSERT_TRUE(s == BIGNUM_DIV_U64_OK && q[0] == 2 && q[1] == 0 && q[2] == 0 && r == 1, "High zero quotient limbs are written");
+}
+
+void test_in_place(void) {
+    uint64_t r, r_ref;
+    for (size_t i = 0; i < MAX_LIMBS; ++i) n_buf[i] = rng_next();
+    r_ref = reference_div(q_ref, n_buf, MAX_LIMBS, 1000000007ull);
+    bignum_div_u64_status_t s = bignum_div_u64_limbs(n_buf, n_buf, MAX_LIMBS, 1000000007ull, &r);
+    ASSERT_TRUE(s == BIGNUM_DIV_U64_OK, "In-place division returns OK");
+    ASSERT_TRUE(r == r_ref && memcmp(n_buf, q_ref, sizeof(q_ref)) == 0, "In-place division is correct");
+}
+
+void test_matches_bignum_div_u64(void) {
+    bool ok = true;
+    for (int len = 1; len <= BIGNUM_CAPACITY; ++len) {
+        bignum_t n, q;
+        uint64_t limbs[BIGNUM_CAPACITY], r1, r2;
+        uint64_t d = rng_next() >> (rng_next() % 64);
+        if (d == 0) d = 7;
+        memset(&n, 0, sizeof(n));
+        n.len = len;
+        for (int i = 0; i < len; ++i) n.words[i] = rng_next();
+        if (bignum_div_u64(&q, &n, d, &r1) != BIGNUM_DIV_U64_OK) ok = false;
+        if (bignum_div_u64_limbs(limbs, n.words, (size_t)len, d, &r2) != BIGNUM_DIV_U64_OK) ok = false;
+        if (r1 != r2 || memcmp(limbs, q.words, (size_t)len * sizeof(uint64_t)) != 0) ok = false;
+    }
+    ASSERT_TRUE(ok, "Matches bignum_div_u64 on bignum_t-sized inputs");
+}
+
+void test_zero_length(void) {
+    uint64_t r = 123;
+    ASSERT_TRUE(bignum_div_u64_limbs(NULL, NULL, 0, 7, &r) == BIGNUM_DIV_U64_OK && r == 0, "len == 0 gives remainder 0");
+    ASSERT_TRUE(bignum_div_u64_limbs(NULL, NULL, 0, 0, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "len == 0 still rejects d == 0");
+}
+
+void test_errors(void) {
+    uint64_t buf[8] = {1, 2, 3, 4, 5, 6, 7, 8}, q[4], r = 55;
+    ASSERT_TRUE(bignum_div_u64_limbs(q, buf, 4, 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL rem");
+    ASSERT_TRUE(bignum_div_u64_limbs(NULL, buf, 4, 3, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL q");
+    ASSERT_TRUE(bignum_div_u64_limbs(q, NULL, 4, 3, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_div_u64_limbs(q, buf, 4, 0, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Division by zero");
+    ASSERT_TRUE(bignum_div_u64_limbs(buf + 1, buf, 4, 3, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP, "q above n overlaps");
+    ASSERT_TRUE(bignum_div_u64_limbs(buf, buf + 3, 4, 3, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP, "q below n overlaps");
+    ASSERT_TRUE(bignum_div_u64_limbs(buf + 4, buf, 4, 3, &r) == BIGNUM_DIV_U64_OK, "Adjacent buffers are accepted");
+    ASSERT_TRUE(r == 1 && buf[0] == 1, "Adjacent division leaves n intact");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64_limbs ===\n");
+
+    RUN_TEST(test_random_lengths);
+    RUN_TEST(test_high_zero_limbs);
+    RUN_TEST(test_in_place);
+    RUN_TEST(test_matches_bignum_div_u64);
+    RUN_TEST(test_zero_length);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,202 @@
+/**
+ * @file    test_bignum_div_u64_mod.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты вычисления остатка без частного (bignum_mod_u64).
+ *
+ * @details
+ *   Проверяет таблицу степеней контекста, совпадение остатка
+ *   bignum_mod_u64 и bignum_mod_u64_pre с остатком bignum_div_u64 на
+ *   псевдослучайных данных, все делители 2^64 - 1 и 2^64 + 1 (путь суммы
+ *   слов) и их соседей, обработку ошибок.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ *   - rev. 2 (16.10.2026): Делители 2^64 - 1 и 2^64 + 1.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0xD1B54A32D192ED03ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** Сравнивает оба варианта bignum_mod_u64 с остатком bignum_div_u64. */
+static bool cross_check(uint64_t d, int rounds) {
+    bignum_mod_u64_ctx_t ctx;
+    if (bignum_mod_u64_ctx_init(&ctx, d) != BIGNUM_DIV_U64_OK) return false;
+    for (int round = 0; round < rounds; ++round) {
+        for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            bignum_t n, q;
+            uint64_t r_ref, r_mod = 1, r_pre = 1;
+            bignum_random(&n, len);
+            if (round == 0) {
+                for (int i = 0; i < len; ++i) n.words[i] = UINT64_MAX;
+            }
+            bignum_div_u64(&q, &n, d, &r_ref);
+            if (bignum_mod_u64(&n, d, &r_mod) != BIGNUM_DIV_U64_OK) return false;
+            if (bignum_mod_u64_pre(&n, &ctx, &r_pre) != BIGNUM_DIV_U64_OK) return false;
+            if (r_mod != r_ref || r_pre != r_ref) return false;
+        }
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_ctx_powers() {
+    bignum_mod_u64_ctx_t ctx;
+    ASSERT_TRUE(bignum_mod_u64_ctx_init(&ctx, 1) == BIGNUM_DIV_U64_OK, "Init for d = 1");
+    ASSERT_TRUE(ctx.pow[0] == 0 && ctx.pow[BIGNUM_CAPACITY - 1] == 0, "Powers modulo 1 are zero");
+    ASSERT_TRUE(bignum_mod_u64_ctx_init(&ctx, UINT64_MAX) == BIGNUM_DIV_U64_OK, "Init for d = 2^64 - 1");
+    ASSERT_TRUE(ctx.pow[0] == 1 && ctx.pow[1] == 1 && ctx.pow[BIGNUM_CAPACITY - 1] == 1, "2^(64i) mod (2^64 - 1) = 1");
+    ASSERT_TRUE(bignum_mod_u64_ctx_init(&ctx, 10) == BIGNUM_DIV_U64_OK, "Init for d = 10");
+    ASSERT_TRUE(ctx.pow[0] == 1 && ctx.pow[1] == 6 && ctx.pow[2] == 6, "2^(64i) mod 10 = 6 for i >= 1");
+    ASSERT_TRUE(ctx.div.d == 10 && ctx.div.shift == 60, "Reciprocal part is filled");
+}
+
+void test_simple_values() {
+    bignum_t n;
+    uint64_t r = 0;
+    memset(&n, 0, sizeof(n));
+    n.len = 3;
+    n.words[1] = 10;
+    n.words[0] = 5;
+    ASSERT_TRUE(bignum_mod_u64(&n, 10, &r) == BIGNUM_DIV_U64_OK && r == 5, "Remainder with leading zero word");
+    n.len = 0;
+    r = 1;
+    ASSERT_TRUE(bignum_mod_u64(&n, 10, &r) == BIGNUM_DIV_U64_OK && r == 0, "Zero dividend gives zero remainder");
+}
+
+void test_matches_div() {
+    static const uint64_t divisors[] = {
+        1, 2, 3, 10, 0xFFFFFFFFull, 0x100000001ull, 1000000000000000000ull,
+        0x8000000000000000ull, 0x8000000000000001ull, 0xFFFFFFFFFFFFFFFFull
+    };
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(divisors) / sizeof(divisors[0]); ++i) {
+        ok = ok && cross_check(divisors[i], 3);
+    }
+    ASSERT_TRUE(ok, "Edge divisors match bignum_div_u64");
+
+    ok = true;
+    for (int bits = 1; bits <= 64; ++bits) {
+        uint64_t d = rng_next() >> (64 - bits);
+        ok = ok && cross_check(d ? d : 1, 2);
+    }
+    ASSERT_TRUE(ok, "Random divisors of every bit size match bignum_div_u64");
+}
+
+void test_limb_sum_divisors() {
+    // 2^64 - 1 = 3 * 5 * 17 * 257 * 641 * 65537 * 6700417
+    static const uint64_t minus_primes[] = { 3, 5, 17, 257, 641, 65537, 6700417 };
+    bool ok = true;
+    for (unsigned mask = 0; mask < 128; ++mask) {
+        uint64_t d = 1;
+        for (int i = 0; i < 7; ++i) {
+            if (mask & (1u << i)) d *= minus_primes[i];
+        }
+        ok = ok && cross_check(d, 2) && cross_check(d + 2, 1) && cross_check(d * 2, 1);
+    }
+    ASSERT_TRUE(ok, "All 128 divisors of 2^64 - 1, d + 2 and 2d match bignum_div_u64");
+
+    // 2^64 + 1 = 274177 * 67280421310721
+    static const uint64_t plus_divisors[] = { 274177, 67280421310721ull };
+    ok = true;
+    for (size_t i = 0; i < 2; ++i) {
+        uint64_t d = plus_divisors[i];
+        ok = ok && cross_check(d, 4) && cross_check(d - 2, 1) && cross_check(d + 2, 1);
+    }
+    ASSERT_TRUE(ok, "Divisors of 2^64 + 1 and their neighbours match bignum_div_u64");
+
+    bignum_t n;
+    uint64_t r = 0;
+    memset(&n, 0, sizeof(n));
+    n.len = 8;
+    n.words[1] = 1;  // 2^64
+    ASSERT_TRUE(bignum_mod_u64(&n, 274177, &r) == BIGNUM_DIV_U64_OK && r == 274176, "2^64 mod 274177 == -1");
+    ASSERT_TRUE(bignum_mod_u64(&n, 6700417, &r) == BIGNUM_DIV_U64_OK && r == 1, "2^64 mod 6700417 == 1");
+}
+
+// --- Тесты на обработку ошибок ---
+
+void test_errors() {
+    bignum_mod_u64_ctx_t ctx, ctx_zero;
+    bignum_t n;
+    uint64_t r;
+    memset(&ctx_zero, 0, sizeof(ctx_zero));
+    bignum_random(&n, 2);
+    bignum_mod_u64_ctx_init(&ctx, 3);
+    ASSERT_TRUE(bignum_mod_u64_ctx_init(NULL, 3) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Init handles NULL context");
+    ASSERT_TRUE(bignum_mod_u64_ctx_init(&ctx_zero, 0) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Init handles zero divisor");
+    ASSERT_TRUE(bignum_mod_u64(NULL, 3, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL dividend");
+    ASSERT_TRUE(bignum_mod_u64(&n, 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL remainder");
+    ASSERT_TRUE(bignum_mod_u64(&n, 0, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Handles division by zero");
+    ASSERT_TRUE(bignum_mod_u64_pre(NULL, &ctx, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Pre handles NULL dividend");
+    ASSERT_TRUE(bignum_mod_u64_pre(&n, NULL, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Pre handles NULL context");
+    ASSERT_TRUE(bignum_mod_u64_pre(&n, &ctx, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Pre handles NULL remainder");
+    ASSERT_TRUE(bignum_mod_u64_pre(&n, &ctx_zero, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Pre handles uninitialized context");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_mod_u64(&n, 3, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Handles bad length");
+    ASSERT_TRUE(bignum_mod_u64_pre(&n, &ctx, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Pre handles bad length");
+    n.len = -1;
+    ASSERT_TRUE(bignum_mod_u64(&n, 3, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Handles negative length");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_mod_u64 ===\n");
+
+    RUN_TEST(test_ctx_powers);
+    RUN_TEST(test_simple_values);
+    RUN_TEST(test_matches_div);
+    RUN_TEST(test_limb_sum_divisors);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,201 @@
+/**
+ * @file    test_bignum_div_u64_multi.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты остатков по многим делителям (bignum_mod_u64_multi,
+ *          bignum_mod_u64_multi_limbs).
+ *
+ * @details
+ *   Сверяет каждый остаток с bignum_div_u64 для наборов делителей разной
+ *   величины (малые SSE2-полосы, большие скалярные полосы и их смесь),
+ *   числа делителей больше одной группы и всех длин делимого, а также
+ *   проверяет, что при ошибке валидации массив остатков не изменяется.
+ *   Вариант для массива слов сверяется с bignum_div_u64_limbs на делимых
+ *   длиннее BIGNUM_CAPACITY.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ *   - rev. 2 (16.10.2026): Тесты bignum_mod_u64_multi_limbs.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define MAX_DIVISORS 80
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** Сверяет остатки bignum_mod_u64_multi с bignum_div_u64 для всех длин n. */
+static bool check_multi(const uint64_t *d, size_t k) {
+    for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+        bignum_t n, q;
+        uint64_t rem[MAX_DIVISORS], r_ref;
+        bignum_random(&n, len);
+        if (len % 3 == 0) {
+            for (int i = 0; i < len; ++i) n.words[i] = UINT64_MAX;
+        }
+        memset(rem, 0xA5, sizeof(rem));
+        if (bignum_mod_u64_multi(&n, d, k, rem) != BIGNUM_DIV_U64_OK) return false;
+        for (size_t j = 0; j < k; ++j) {
+            if (bignum_div_u64(&q, &n, d[j], &r_ref) != BIGNUM_DIV_U64_OK) return false;
+            if (rem[j] != r_ref) return false;
+        }
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_small_divisors() {
+    static const uint64_t d[] = { 1, 2, 3, 7, 10, 255, 65521, (1u << 21) - 1, 1u << 20 };
+    ASSERT_TRUE(check_multi(d, sizeof(d) / sizeof(d[0])), "Small divisors (SIMD lanes) match bignum_div_u64");
+}
+
+void test_large_divisors() {
+    static const uint64_t d[] = {
+        1u << 21, 0xFFFFFFFFull, 0x100000001ull, 1000000000000000000ull,
+        0x8000000000000000ull, 0x8000000000000001ull, 0xFFFFFFFFFFFFFFFFull
+    };
+    ASSERT_TRUE(check_multi(d, sizeof(d) / sizeof(d[0])), "Large divisors (scalar lanes) match bignum_div_u64");
+}
+
+void test_random_mixed_divisors() {
+    uint64_t d[MAX_DIVISORS];
+    bool ok = true;
+    for (int round = 0; round < 12; ++round) {
+        size_t k = 1 + rng_next() % MAX_DIVISORS;
+        for (size_t j = 0; j < k; ++j) {
+            uint64_t v = rng_next() >> (rng_next() % 64);
+            d[j] = v ? v : 1;
+        }
+        ok = ok && check_multi(d, k);
+    }
+    ASSERT_TRUE(ok, "Random mixed divisors over several groups match bignum_div_u64");
+}
+
+void test_no_divisors() {
+    bignum_t n;
+    uint64_t d[1] = { 7 }, rem[1] = { 42 };
+    bignum_random(&n, 4);
+    ASSERT_TRUE(bignum_mod_u64_multi(&n, d, 0, rem) == BIGNUM_DIV_U64_OK && rem[0] == 42, "Zero divisors is a no-op");
+}
+
+void test_limbs_long_dividends() {
+    static uint64_t n[1000], q[1000];
+    uint64_t d[MAX_DIVISORS], rem[MAX_DIVISORS], r_ref;
+    bool ok = true;
+    for (int round = 0; round < 40 && ok; ++round) {
+        size_t len = rng_next() % 1000;
+        size_t k = 1 + rng_next() % MAX_DIVISORS;
+        for (size_t i = 0; i < len; ++i) n[i] = rng_next();
+        if (round % 4 == 1 && len > 0) n[len - 1] = 0;      // старший ноль
+        for (size_t j = 0; j < k; ++j) d[j] = (rng_next() >> (rng_next() % 64)) | 1;
+        ok = bignum_mod_u64_multi_limbs(n, len, d, k, rem) == BIGNUM_DIV_U64_OK;
+        for (size_t j = 0; j < k && ok; ++j) {
+            ok = bignum_div_u64_limbs(q, n, len, d[j], &r_ref) == BIGNUM_DIV_U64_OK && rem[j] == r_ref;
+        }
+    }
+    ASSERT_TRUE(ok, "Limb arrays of 0..999 words match bignum_div_u64_limbs");
+
+    d[0] = 12345;
+    rem[0] = 7;
+    ASSERT_TRUE(bignum_mod_u64_multi_limbs(NULL, 0, d, 1, rem) == BIGNUM_DIV_U64_OK && rem[0] == 0,
+                "len = 0 with NULL n gives zero remainders");
+}
+
+// --- Тесты на обработку ошибок ---
+
+void test_errors_leave_outputs_untouched() {
+    bignum_t n;
+    uint64_t d[3] = { 3, 5, 7 };
+    uint64_t rem[3] = { 11, 22, 33 };
+    bignum_random(&n, 4);
+
+    ASSERT_TRUE(bignum_mod_u64_multi(NULL, d, 3, rem) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL dividend");
+    ASSERT_TRUE(bignum_mod_u64_multi(&n, NULL, 3, rem) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL divisor array");
+    ASSERT_TRUE(bignum_mod_u64_multi(&n, d, 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL remainder array");
+
+    d[2] = 0;
+    ASSERT_TRUE(bignum_mod_u64_multi(&n, d, 3, rem) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Handles zero divisor in array");
+    d[2] = 7;
+
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_mod_u64_multi(&n, d, 3, rem) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Handles bad length");
+    n.len = -1;
+    ASSERT_TRUE(bignum_mod_u64_multi(&n, d, 3, rem) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Handles negative length");
+
+    ASSERT_TRUE(rem[0] == 11 && rem[1] == 22 && rem[2] == 33, "Remainders untouched on error");
+}
+
+void test_limbs_errors() {
+    uint64_t n[4] = { 1, 2, 3, 4 };
+    uint64_t d[3] = { 3, 0, 7 };
+    uint64_t rem[3] = { 11, 22, 33 };
+
+    ASSERT_TRUE(bignum_mod_u64_multi_limbs(NULL, 4, d, 3, rem) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Limbs: NULL n with len > 0");
+    ASSERT_TRUE(bignum_mod_u64_multi_limbs(n, 4, NULL, 3, rem) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Limbs: NULL divisor array");
+    ASSERT_TRUE(bignum_mod_u64_multi_limbs(n, 4, d, 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Limbs: NULL remainder array");
+    ASSERT_TRUE(bignum_mod_u64_multi_limbs(n, 4, d, 3, rem) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Limbs: zero divisor in array");
+    ASSERT_TRUE(rem[0] == 11 && rem[1] == 22 && rem[2] == 33, "Limbs: remainders untouched on error");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_mod_u64_multi ===\n");
+
+    RUN_TEST(test_small_divisors);
+    RUN_TEST(test_large_divisors);
+    RUN_TEST(test_random_mixed_divisors);
+    RUN_TEST(test_no_divisors);
+    RUN_TEST(test_limbs_long_dividends);
+    RUN_TEST(test_errors_leave_outputs_untouched);
+    RUN_TEST(test_limbs_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file    test_bignum_div_u64_pmersenne.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief   Тесты для функций bignum_mod_u64_pmersenne и bignum_mod_u64_mersenne.
+ *
+ * @details
+ *   Сверяет остатки с bignum_mod_u64 для модулей 2^64 - c (граничные и
+ *   случайные c, Goldilocks) и 2^k - 1 для всех k на всех длинах, в том
+ *   числе на словах из одних единиц, где свёртка чаще всего переносит;
+ *   проверяет коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x3C6EF372FE94F82Bull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/** Делимое длины len; round выбирает случайные слова, одни единицы или p - 1 и p. */
+static void make_dividend(bignum_t *bn, int len, int round, uint64_t p) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+        if (round == 1) bn->words[i] = ~0ull;
+        if (round == 2) bn->words[i] = (i & 1) ? p : p - 1;
+    }
+    if (round == 3 && len > 0) bn->words[len - 1] = 1;
+}
+
+/** Сверяет bignum_mod_u64_pmersenne(c) с bignum_mod_u64 на всех длинах. */
+static bool pmersenne_matches(uint64_t c) {
+    uint64_t p = 0 - c;
+    for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+        for (int round = 0; round < 6; ++round) {
+            bignum_t n;
+            uint64_t r = 1, r_ref = 2;
+            make_dividend(&n, len, round, p);
+            if (bignum_mod_u64(&n, p, &r_ref) != BIGNUM_DIV_U64_OK) return false;
+            if (bignum_mod_u64_pmersenne(&n, c, &r) != BIGNUM_DIV_U64_OK || r != r_ref) return false;
+        }
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_pmersenne_edge_c(void) {
+    ASSERT_TRUE(pmersenne_matches(1), "c = 1 (2^64 - 1)");
+    ASSERT_TRUE(pmersenne_matches(2), "c = 2");
+    ASSERT_TRUE(pmersenne_matches(59), "c = 59 (largest prime below 2^64)");
+    ASSERT_TRUE(pmersenne_matches(BIGNUM_MOD_U64_GOLDILOCKS_C), "Goldilocks, c = 2^32 - 1");
+    ASSERT_TRUE(pmersenne_matches(0x80000000ull), "c = 2^31");
+}
+
+void test_pmersenne_random_c(void) {
+    bool ok = true;
+    for (int i = 0; i < 64 && ok; ++i) {
+        uint64_t c = rng_next() >> (32 + (i & 31));
+        if (c == 0) c = 3;
+        ok = pmersenne_matches(c);
+    }
+    ASSERT_TRUE(ok, "Random c of every bit width below 2^32");
+}
+
+void test_mersenne_all_k(void) {
+    bool ok = true;
+    for (unsigned k = 2; k <= 64 && ok; ++k) {
+        uint64_t p = (k == 64) ? ~0ull : (1ull << k) - 1;
+        for (int len = 0; len <= BIGNUM_CAPACITY && ok; ++len) {
+            for (int round = 0; round < 6; ++round) {
+                bignum_t n;
+                uint64_t r = 1, r_ref = 2;
+                make_dividend(&n, len, round, p);
+                if (bignum_mod_u64(&n, p, &r_ref) != BIGNUM_DIV_U64_OK) ok = false;
+                if (bignum_mod_u64_mersenne(&n, k, &r) != BIGNUM_DIV_U64_OK || r != r_ref) ok = false;
+            }
+        }
+    }
+    ASSERT_TRUE(ok, "2^k - 1 matches bignum_mod_u64 for k = 2..64");
+}
+
+void test_known_values(void) {
+    bignum_t n;
+    uint64_t r = 1;
+    memset(&n, 0, sizeof(n));
+    n.len = 2;
+    n.words[1] = 1;  // 2^64
+    ASSERT_TRUE(bignum_mod_u64_pmersenne(&n, BIGNUM_MOD_U64_GOLDILOCKS_C, &r) == BIGNUM_DIV_U64_OK &&
+                r == 0xFFFFFFFFull, "2^64 mod Goldilocks == 2^32 - 1");
+    ASSERT_TRUE(bignum_mod_u64_mersenne(&n, 61, &r) == BIGNUM_DIV_U64_OK && r == 8, "2^64 mod (2^61 - 1) == 8");
+    n.len = 1;
+    n.words[0] = (1ull << 61) - 1;
+    n.words[1] = 0;
+    ASSERT_TRUE(bignum_mod_u64_mersenne(&n, 61, &r) == BIGNUM_DIV_U64_OK && r == 0, "(2^61 - 1) mod (2^61 - 1) == 0");
+    n.len = 0;
+    r = 1;
+    ASSERT_TRUE(bignum_mod_u64_pmersenne(&n, 5, &r) == BIGNUM_DIV_U64_OK && r == 0, "n = 0 gives 0");
+}
+
+void test_errors(void) {
+    bignum_t n;
+    uint64_t r;
+    make_dividend(&n, 2, 0, 0);
+    ASSERT_TRUE(bignum_mod_u64_pmersenne(NULL, 5, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "pmersenne: NULL n");
+    ASSERT_TRUE(bignum_mod_u64_pmersenne(&n, 5, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "pmersenne: NULL rem");
+    ASSERT_TRUE(bignum_mod_u64_pmersenne(&n, 0, &r) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "pmersenne: c = 0");
+    ASSERT_TRUE(bignum_mod_u64_pmersenne(&n, 1ull << 32, &r) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "pmersenne: c = 2^32");
+    ASSERT_TRUE(bignum_mod_u64_mersenne(NULL, 61, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "mersenne: NULL n");
+    ASSERT_TRUE(bignum_mod_u64_mersenne(&n, 61, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "mersenne: NULL rem");
+    ASSERT_TRUE(bignum_mod_u64_mersenne(&n, 1, &r) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "mersenne: k = 1");
+    ASSERT_TRUE(bignum_mod_u64_mersenne(&n, 65, &r) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "mersenne: k = 65");
+    n.len = -1;
+    ASSERT_TRUE(bignum_mod_u64_pmersenne(&n, 0, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "pmersenne: length checked before c");
+    ASSERT_TRUE(bignum_mod_u64_mersenne(&n, 61, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "mersenne: negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_mod_u64_pmersenne(&n, 5, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "pmersenne: length above capacity");
+    ASSERT_TRUE(bignum_mod_u64_mersenne(&n, 61, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "mersenne: length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_mod_u64_pmersenne ===\n");
+
+    RUN_TEST(test_pmersenne_edge_c);
+    RUN_TEST(test_pmersenne_random_c);
+    RUN_TEST(test_mersenne_all_k);
+    RUN_TEST(test_known_values);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,208 @@
+/**
+ * @file    test_bignum_div_u64_pre.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты деления с предвычисленным контекстом делителя.
+ *
+ * @details
+ *   Проверяет bignum_div_u64_ctx_init и bignum_div_u64_pre: граничные
+ *   делители (1, степени двойки, 2^64 - 1), обработку ошибок и
+ *   побитовое совпадение результата с bignum_div_u64 на псевдослучайных
+ *   данных с фиксированным зерном.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ *   - rev. 2 (15.10.2026): Проверка деления на месте (q == n).
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** Сравнивает q, q->len, нулевой хвост и остаток двух результатов. */
+static bool results_equal(const bignum_t *a, uint64_t ra, const bignum_t *b, uint64_t rb) {
+    return a->len == b->len && ra == rb &&
+           memcmp(a->words, b->words, sizeof(a->words)) == 0;
+}
+
+/** Прогоняет случайные делимые всех длин через оба ядра с делителем d, в том числе на месте. */
+static bool cross_check(uint64_t d, int rounds) {
+    bignum_div_u64_ctx_t ctx;
+    if (bignum_div_u64_ctx_init(&ctx, d) != BIGNUM_DIV_U64_OK) return false;
+    for (int round = 0; round < rounds; ++round) {
+        for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            bignum_t n, q_ref, q_pre, n_in_place;
+            uint64_t r_ref = 0, r_pre = 0, r_in_place = 0;
+            bignum_random(&n, len);
+            memset(&q_pre, 0xA5, sizeof(q_pre));
+            if (bignum_div_u64(&q_ref, &n, d, &r_ref) != BIGNUM_DIV_U64_OK) return false;
+            if (bignum_div_u64_pre(&q_pre, &n, &ctx, &r_pre) != BIGNUM_DIV_U64_OK) return false;
+            if (!results_equal(&q_ref, r_ref, &q_pre, r_pre)) return false;
+
+            n_in_place = n;
+            if (bignum_div_u64_pre(&n_in_place, &n_in_place, &ctx, &r_in_place) != BIGNUM_DIV_U64_OK) return false;
+            if (!results_equal(&q_ref, r_ref, &n_in_place, r_in_place)) return false;
+            n_in_place = n;
+            if (bignum_div_u64(&n_in_place, &n_in_place, d, &r_in_place) != BIGNUM_DIV_U64_OK) return false;
+            if (!results_equal(&q_ref, r_ref, &n_in_place, r_in_place)) return false;
+        }
+    }
+    return true;
+}
+
+// --- Тестовые случаи ---
+
+void test_ctx_init() {
+    bignum_div_u64_ctx_t ctx;
+    ASSERT_TRUE(bignum_div_u64_ctx_init(&ctx, 1) == BIGNUM_DIV_U64_OK, "Init for d = 1");
+    ASSERT_TRUE(ctx.d == 1 && ctx.shift == 63 && ctx.dnorm == (1ull << 63), "Normalization for d = 1");
+    ASSERT_TRUE(ctx.v == UINT64_MAX, "Reciprocal for d = 2^63");
+    ASSERT_TRUE(bignum_div_u64_ctx_init(&ctx, UINT64_MAX) == BIGNUM_DIV_U64_OK, "Init for d = 2^64 - 1");
+    ASSERT_TRUE(ctx.shift == 0 && ctx.dnorm == UINT64_MAX && ctx.v == 1, "Reciprocal for d = 2^64 - 1");
+}
+
+void test_happy_path_division() {
+    bignum_div_u64_ctx_t ctx;
+    bignum_t n, q;
+    uint64_t r;
+    memset(&n, 0, sizeof(n));
+    n.len = 2;
+    n.words[1] = 0x123456789ABCDEF1;
+    bignum_div_u64_ctx_init(&ctx, 0xFFFFFFFFFFFFFFFF);
+    bignum_div_u64_status_t status = bignum_div_u64_pre(&q, &n, &ctx, &r);
+    ASSERT_TRUE(status == BIGNUM_DIV_U64_OK, "Status is OK");
+    ASSERT_TRUE(q.len == 1 && q.words[0] == 0x123456789ABCDEF1 && q.words[1] == 0, "Quotient is correct");
+    ASSERT_TRUE(r == 0x123456789ABCDEF1, "Remainder is correct");
+}
+
+void test_leading_zeros_in_dividend() {
+    bignum_div_u64_ctx_t ctx;
+    bignum_t n, q;
+    uint64_t r;
+    memset(&n, 0, sizeof(n));
+    n.len = 3;
+    n.words[1] = 10;
+    n.words[0] = 5;
+    bignum_div_u64_ctx_init(&ctx, 10);
+    bignum_div_u64_status_t status = bignum_div_u64_pre(&q, &n, &ctx, &r);
+    ASSERT_TRUE(status == BIGNUM_DIV_U64_OK, "Status is OK");
+    ASSERT_TRUE(q.len == 2 && q.words[1] == 1 && q.words[0] == 0, "Quotient is correct with leading zeros");
+    ASSERT_TRUE(r == 5, "Remainder is correct with leading zeros");
+}
+
+void test_zero_dividend() {
+    bignum_div_u64_ctx_t ctx;
+    bignum_t n, q;
+    uint64_t r = 1;
+    memset(&n, 0, sizeof(n));
+    memset(&q, 0xFF, sizeof(q));
+    bignum_div_u64_ctx_init(&ctx, 7);
+    ASSERT_TRUE(bignum_div_u64_pre(&q, &n, &ctx, &r) == BIGNUM_DIV_U64_OK, "Status is OK");
+    ASSERT_TRUE(q.len == 0 && q.words[BIGNUM_CAPACITY - 1] == 0 && r == 0, "Zero dividend gives zero quotient");
+}
+
+void test_matches_hardware_div() {
+    static const uint64_t divisors[] = {
+        1, 2, 3, 7, 10, 1000000007ull, 0xFFFFFFFFull, 0x100000000ull,
+        1000000000000000000ull, 0x7FFFFFFFFFFFFFFFull, 0x8000000000000000ull,
+        0x8000000000000001ull, 0xFFFFFFFFFFFFFFFEull, 0xFFFFFFFFFFFFFFFFull
+    };
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(divisors) / sizeof(divisors[0]); ++i) {
+        ok = ok && cross_check(divisors[i], 4);
+    }
+    ASSERT_TRUE(ok, "Edge divisors match bignum_div_u64");
+
+    ok = true;
+    for (int bits = 1; bits <= 64; ++bits) {
+        uint64_t d = rng_next() >> (64 - bits);
+        ok = ok && cross_check(d ? d : 1, 2);
+    }
+    ASSERT_TRUE(ok, "Random divisors of every bit size match bignum_div_u64");
+}
+
+// --- Тесты на обработку ошибок ---
+
+void test_errors() {
+    bignum_div_u64_ctx_t ctx, ctx_zero;
+    bignum_t n, q;
+    uint64_t r;
+    memset(&ctx_zero, 0, sizeof(ctx_zero));
+    memset(&n, 0, sizeof(n));
+    n.len = 1;
+    n.words[0] = 10;
+    bignum_div_u64_ctx_init(&ctx, 3);
+    ASSERT_TRUE(bignum_div_u64_ctx_init(NULL, 3) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Init handles NULL context");
+    ASSERT_TRUE(bignum_div_u64_ctx_init(&ctx_zero, 0) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Init handles zero divisor");
+    ASSERT_TRUE(bignum_div_u64_pre(NULL, &n, &ctx, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL quotient");
+    ASSERT_TRUE(bignum_div_u64_pre(&q, NULL, &ctx, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL dividend");
+    ASSERT_TRUE(bignum_div_u64_pre(&q, &n, NULL, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL context");
+    ASSERT_TRUE(bignum_div_u64_pre(&q, &n, &ctx, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Handles NULL remainder");
+    ASSERT_TRUE(bignum_div_u64_pre(&q, &n, &ctx_zero, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Handles uninitialized context");
+    ASSERT_TRUE(bignum_div_u64_pre((bignum_t *)&n.words[2], &n, &ctx, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP, "Handles partial buffer overlap");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_div_u64_pre(&q, &n, &ctx, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Handles bad length");
+    n.len = -1;
+    ASSERT_TRUE(bignum_div_u64_pre(&q, &n, &ctx, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Handles negative length");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64_pre ===\n");
+
+    RUN_TEST(test_ctx_init);
+    RUN_TEST(test_happy_path_division);
+    RUN_TEST(test_leading_zeros_in_dividend);
+    RUN_TEST(test_zero_dividend);
+    RUN_TEST(test_matches_hardware_div);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
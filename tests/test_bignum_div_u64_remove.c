@@ -0,0 +1,233 @@
+/**
+ * @file    test_bignum_div_u64_remove.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief   Тесты для функции bignum_remove_factor_u64.
+ *
+ * @details
+ *   Строит n = a * p^e для a, не делящегося на p, и проверяет, что функция
+ *   возвращает e и a, для простых, составных, чётных, больших p и степеней
+ *   двойки при кратностях от 0 до предела ёмкости. Результат также
+ *   сверяется с наивным циклом bignum_div_u64 на случайных числах.
+ *   Проверяются n = 0 (в том числе из нулевых слов при len > 0), делимые
+ *   со старшими нулевыми словами и коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0xBF58476D1CE4E5B9ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+static const size_t COMPARED_BYTES = offsetof(bignum_t, len) + sizeof(int32_t);
+
+/** n *= p; возвращает false при переполнении ёмкости. */
+static bool bignum_mul_u64(bignum_t *n, uint64_t p) {
+    __extension__ typedef unsigned __int128 u128_t;
+    uint64_t carry = 0;
+    for (int i = 0; i < n->len; ++i) {
+        u128_t t = (u128_t)n->words[i] * p + carry;
+        n->words[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
+    if (carry != 0) {
+        if (n->len == BIGNUM_CAPACITY) return false;
+        n->words[n->len++] = carry;
+    }
+    return true;
+}
+
+/** Наивное удаление: делить, пока остаток равен нулю. */
+static unsigned remove_naive(bignum_t *n, uint64_t p) {
+    unsigned count = 0;
+    if (n->len == 0) return 0;
+    for (;;) {
+        bignum_t q;
+        uint64_t rem;
+        bignum_div_u64(&q, n, p, &rem);
+        if (rem != 0) return count;
+        *n = q;
+        ++count;
+    }
+}
+
+/** Проверяет a * p^e для всех e, пока произведение помещается в bignum_t. */
+static bool strips_powers(uint64_t p, int a_len) {
+    bignum_t a;
+    bignum_random(&a, a_len);
+    while (a.len > 0 && a.words[a.len - 1] == 0) --a.len;
+    if (a.len == 0) {
+        a.len = 1;
+        a.words[0] = 1;
+    }
+    remove_naive(&a, p);  // a не делится на p
+    bignum_t n = a;
+    for (unsigned e = 0;; ++e) {
+        bignum_t m = n;
+        unsigned count = 12345;
+        if (bignum_remove_factor_u64(&m, p, &count) != BIGNUM_DIV_U64_OK) return false;
+        if (count != e || memcmp(&m, &a, COMPARED_BYTES) != 0) return false;
+        if (!bignum_mul_u64(&n, p)) return true;
+    }
+}
+
+// --- Тестовые случаи ---
+
+void test_primes(void) {
+    ASSERT_TRUE(strips_powers(3, 1) && strips_powers(3, 5), "p = 3");
+    ASSERT_TRUE(strips_powers(5, 2) && strips_powers(7, 3), "p = 5, 7");
+    ASSERT_TRUE(strips_powers(65537, 4), "p = 65537");
+    ASSERT_TRUE(strips_powers(4294967291ull, 2), "p = 2^32 - 5");
+    ASSERT_TRUE(strips_powers(18446744073709551557ull, 1), "p = 2^64 - 59");
+}
+
+void test_composites(void) {
+    ASSERT_TRUE(strips_powers(6, 3), "p = 6");
+    ASSERT_TRUE(strips_powers(15, 2), "p = 15");
+    ASSERT_TRUE(strips_powers(1000000000000000000ull, 2), "p = 10^18");
+    ASSERT_TRUE(strips_powers(0xFFFFFFFFFFFFFFFFull, 1), "p = 2^64 - 1");
+}
+
+void test_powers_of_two(void) {
+    ASSERT_TRUE(strips_powers(2, 1), "p = 2");
+    ASSERT_TRUE(strips_powers(8, 3), "p = 8");
+    ASSERT_TRUE(strips_powers(1ull << 63, 2), "p = 2^63");
+    bignum_t n;
+    bignum_random(&n, BIGNUM_CAPACITY);
+    n.words[0] = 0;
+    n.words[1] = 0x10;  // tz = 68
+    unsigned count;
+    bignum_t m = n;
+    bool ok = bignum_remove_factor_u64(&m, 1ull << 5, &count) == BIGNUM_DIV_U64_OK && count == 13;  // 13 * 5 = 65
+    bignum_t ref = n;
+    ok = ok && remove_naive(&ref, 1ull << 5) == 13 && memcmp(&m, &ref, COMPARED_BYTES) == 0;
+    ASSERT_TRUE(ok, "p = 2^5 with tz(n) = 68 leaves three low zero bits");
+}
+
+void test_random_against_naive(void) {
+    bool ok = true;
+    for (int i = 0; i < 2000 && ok; ++i) {
+        uint64_t p = (rng_next() % 30) + 2;
+        if (i % 5 == 0) p = rng_next() >> (rng_next() % 64) | 2;
+        bignum_t n;
+        bignum_random(&n, (int)(rng_next() % (BIGNUM_CAPACITY / 2)) + 1);
+        while (n.len > 0 && n.words[n.len - 1] == 0) --n.len;
+        unsigned e = (unsigned)(rng_next() % 40);
+        for (unsigned k = 0; k < e && bignum_mul_u64(&n, p); ++k) {}
+        bignum_t m = n, ref = n;
+        unsigned count;
+        ok = bignum_remove_factor_u64(&m, p, &count) == BIGNUM_DIV_U64_OK &&
+             count == remove_naive(&ref, p) && memcmp(&m, &ref, COMPARED_BYTES) == 0;
+    }
+    ASSERT_TRUE(ok, "Random n and p match a bignum_div_u64 loop");
+}
+
+void test_leading_zeros(void) {
+    static const uint64_t ps[] = { 3, 6, 65537, 2, 8, 1ull << 63 };
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(ps) / sizeof(ps[0]); ++i) {
+        for (int len = 1; len <= BIGNUM_CAPACITY; len += 7) {
+            bignum_t n, m;
+            memset(&n, 0, sizeof(n));
+            n.len = len;  // n = 0 из len нулевых слов
+            m = n;
+            unsigned count = 7;
+            if (bignum_remove_factor_u64(&m, ps[i], &count) != BIGNUM_DIV_U64_OK || count != 0 ||
+                memcmp(&m, &n, COMPARED_BYTES) != 0) ok = false;
+        }
+    }
+    ASSERT_TRUE(ok, "Zero-valued n with len > 0 gives count 0 and is left unchanged");
+
+    ok = true;
+    for (size_t i = 0; i < sizeof(ps) / sizeof(ps[0]); ++i) {
+        bignum_t n;
+        bignum_random(&n, 3);
+        n.words[2] |= 1;
+        remove_naive(&n, ps[i]);
+        for (unsigned e = 0; e < 3; ++e) bignum_mul_u64(&n, ps[i]);
+        bignum_t ref = n, m = n;
+        unsigned count = 0, ref_count = remove_naive(&ref, ps[i]);
+        m.len += 2;  // старшие нулевые слова
+        if (bignum_remove_factor_u64(&m, ps[i], &count) != BIGNUM_DIV_U64_OK || count != ref_count ||
+            memcmp(&m, &ref, COMPARED_BYTES) != 0) ok = false;
+    }
+    ASSERT_TRUE(ok, "Leading zero limbs: same count, result length normalized");
+}
+
+void test_zero_and_errors(void) {
+    bignum_t n;
+    unsigned count = 7;
+    bignum_random(&n, 0);
+    ASSERT_TRUE(bignum_remove_factor_u64(&n, 3, &count) == BIGNUM_DIV_U64_OK && count == 0 && n.len == 0, "n = 0");
+    bignum_random(&n, 2);
+    ASSERT_TRUE(bignum_remove_factor_u64(NULL, 3, &count) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_remove_factor_u64(&n, 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL count");
+    ASSERT_TRUE(bignum_remove_factor_u64(&n, 0, &count) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "p = 0");
+    ASSERT_TRUE(bignum_remove_factor_u64(&n, 1, &count) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "p = 1");
+    n.len = -1;
+    ASSERT_TRUE(bignum_remove_factor_u64(&n, 3, &count) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_remove_factor_u64(&n, 3, &count) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_remove_factor_u64 ===\n");
+
+    RUN_TEST(test_primes);
+    RUN_TEST(test_composites);
+    RUN_TEST(test_powers_of_two);
+    RUN_TEST(test_random_against_naive);
+    RUN_TEST(test_leading_zeros);
+    RUN_TEST(test_zero_and_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,214 @@
+/**
+ * @file    test_bignum_div_u64_tables.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief   Тесты для встроенных таблиц делителей.
+ *
+ * @details
+ *   Сверяет bignum_div_u64_pow10 с bignum_div_u64 (частное, длина, нулевой
+ *   хвост, остаток, деление на месте) для всех k, bignum_mod_u64_small_prime
+ *   с bignum_mod_u64 для всех простых таблицы, содержимое таблиц, коды
+ *   ошибок и pow10 при выбранном ядре preinv.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x2545F4914F6CDD1Dull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+static uint64_t pow10_u64(unsigned k) {
+    uint64_t p = 1;
+    while (k-- > 0) p *= 10;
+    return p;
+}
+
+static const size_t COMPARED_BYTES = offsetof(bignum_t, len) + sizeof(int32_t);
+
+// --- Тестовые случаи ---
+
+void test_pow10_matches_div(void) {
+    bool ok = true;
+    for (unsigned k = 0; k <= BIGNUM_DIV_U64_POW10_MAX; ++k) {
+        for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            for (int round = 0; round < 4; ++round) {
+                bignum_t n, q, q_ref;
+                uint64_t r = 1, r_ref = 2;
+                bignum_random(&n, len);
+                if (round == 1 && len > 0) n.words[len - 1] = 0;                     // старший ноль
+                if (round == 2 && len > 0) n.words[len - 1] = pow10_u64(k) - 1;      // частное короче
+                if (round == 3) memset(n.words, 0xFF, sizeof(uint64_t) * (size_t)len);
+                memset(&q, 0xA5, sizeof(q));
+                memset(&q_ref, 0x5A, sizeof(q_ref));
+                if (bignum_div_u64(&q_ref, &n, pow10_u64(k), &r_ref) != BIGNUM_DIV_U64_OK) ok = false;
+                if (bignum_div_u64_pow10(&q, &n, k, &r) != BIGNUM_DIV_U64_OK) ok = false;
+                if (r != r_ref || memcmp(&q, &q_ref, COMPARED_BYTES) != 0) ok = false;
+                if (bignum_div_u64_pow10(&n, &n, k, &r) != BIGNUM_DIV_U64_OK) ok = false;
+                if (r != r_ref || memcmp(&n, &q_ref, COMPARED_BYTES) != 0) ok = false;
+            }
+        }
+    }
+    ASSERT_TRUE(ok, "pow10 matches bignum_div_u64 for k = 0..19 (q, q->len, tail, rem, in place)");
+}
+
+void test_pow10_ctx_table(void) {
+    bool ok = true;
+    for (unsigned k = 0; k <= BIGNUM_DIV_U64_POW10_MAX; ++k) {
+        bignum_div_u64_ctx_t ctx;
+        bignum_div_u64_ctx_init(&ctx, pow10_u64(k));
+        if (memcmp(&ctx, &bignum_div_u64_pow10_ctx[k], sizeof(ctx)) != 0) ok = false;
+    }
+    ASSERT_TRUE(ok, "bignum_div_u64_pow10_ctx[k] equals bignum_div_u64_ctx_init(10^k)");
+
+    bignum_t n, q, q_ref;
+    uint64_t r, r_ref;
+    bignum_random(&n, BIGNUM_CAPACITY);
+    bignum_div_u64(&q_ref, &n, pow10_u64(19), &r_ref);
+    bignum_div_u64_status_t s = bignum_div_u64_pre(&q, &n, &bignum_div_u64_pow10_ctx[19], &r);
+    ASSERT_TRUE(s == BIGNUM_DIV_U64_OK && r == r_ref && memcmp(&q, &q_ref, COMPARED_BYTES) == 0,
+                "Table context works with bignum_div_u64_pre");
+}
+
+void test_small_primes_table(void) {
+    bool ok = bignum_mod_u64_small_primes[0] == 2 &&
+              bignum_mod_u64_small_primes[BIGNUM_MOD_U64_SMALL_PRIMES - 1] == 1619;
+    uint32_t expected = 2;
+    for (int i = 0; i < BIGNUM_MOD_U64_SMALL_PRIMES && ok; ++i) {
+        if (bignum_mod_u64_small_primes[i] != expected) ok = false;
+        // следующее простое перебором
+        for (++expected;; ++expected) {
+            bool prime = true;
+            for (uint32_t p = 2; p * p <= expected; ++p) {
+                if (expected % p == 0) { prime = false; break; }
+            }
+            if (prime) break;
+        }
+    }
+    ASSERT_TRUE(ok, "bignum_mod_u64_small_primes lists the first 256 primes");
+}
+
+void test_small_prime_mod(void) {
+    bool ok = true;
+    for (unsigned idx = 0; idx < BIGNUM_MOD_U64_SMALL_PRIMES; ++idx) {
+        uint64_t p = bignum_mod_u64_small_primes[idx];
+        for (int len = 0; len <= BIGNUM_CAPACITY; len += (idx < 8) ? 1 : 7) {
+            bignum_t n;
+            uint64_t r = 1, r_ref = 2;
+            bignum_random(&n, len);
+            if ((idx & 3) == 1) memset(n.words, 0xFF, sizeof(uint64_t) * (size_t)len);
+            if (bignum_mod_u64(&n, p, &r_ref) != BIGNUM_DIV_U64_OK) ok = false;
+            if (bignum_mod_u64_small_prime(&n, idx, &r) != BIGNUM_DIV_U64_OK || r != r_ref) ok = false;
+        }
+    }
+    ASSERT_TRUE(ok, "small_prime matches bignum_mod_u64 for every prime in the table");
+
+    bignum_t n;
+    uint64_t r = 1;
+    bignum_random(&n, 3);
+    n.words[2] = 0;
+    n.words[1] = 1;
+    n.words[0] = 0;  // 2^64
+    ASSERT_TRUE(bignum_mod_u64_small_prime(&n, 1, &r) == BIGNUM_DIV_U64_OK && r == 1, "2^64 mod 3 == 1");
+}
+
+void test_pow10_with_reciprocal_kernel(void) {
+    // Ядро preinv: bignum_div_u64_pow10 идёт в bignum_div_u64_pre с таблицей
+    bool ok = bignum_div_u64_set_kernel(BIGNUM_DIV_U64_KERNEL_PREINV) == BIGNUM_DIV_U64_OK;
+    for (unsigned k = 0; k <= BIGNUM_DIV_U64_POW10_MAX; ++k) {
+        for (int len = 0; len <= BIGNUM_CAPACITY; len += 3) {
+            bignum_t n, q, q_ref;
+            uint64_t r = 1, r_ref = 2;
+            bignum_random(&n, len);
+            bignum_div_u64(&q_ref, &n, pow10_u64(k), &r_ref);
+            if (bignum_div_u64_pow10(&q, &n, k, &r) != BIGNUM_DIV_U64_OK) ok = false;
+            if (r != r_ref || memcmp(&q, &q_ref, COMPARED_BYTES) != 0) ok = false;
+        }
+    }
+    ASSERT_TRUE(ok, "pow10 matches bignum_div_u64 with the preinv kernel selected");
+}
+
+void test_errors(void) {
+    bignum_t n, q;
+    uint64_t r;
+    bignum_random(&n, 2);
+    ASSERT_TRUE(bignum_div_u64_pow10(&q, &n, BIGNUM_DIV_U64_POW10_MAX + 1, &r) == BIGNUM_DIV_U64_ERR_UNSUPPORTED, "pow10: k = 20");
+    ASSERT_TRUE(bignum_div_u64_pow10(NULL, &n, 3, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "pow10: NULL q");
+    ASSERT_TRUE(bignum_div_u64_pow10(&q, NULL, 12, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "pow10: NULL n");
+    ASSERT_TRUE(bignum_div_u64_pow10(&q, &n, 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "pow10: NULL rem");
+    bignum_t pair[2];
+    pair[0] = n;
+    ASSERT_TRUE(bignum_div_u64_pow10((bignum_t *)&pair[0].words[1], &pair[0], 3, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP,
+                "pow10: partial overlap");
+    ASSERT_TRUE(bignum_mod_u64_small_prime(&n, BIGNUM_MOD_U64_SMALL_PRIMES, &r) == BIGNUM_DIV_U64_ERR_UNSUPPORTED,
+                "small_prime: idx out of range");
+    ASSERT_TRUE(bignum_mod_u64_small_prime(NULL, 0, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "small_prime: NULL n");
+    ASSERT_TRUE(bignum_mod_u64_small_prime(&n, 0, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "small_prime: NULL rem");
+    n.len = -1;
+    ASSERT_TRUE(bignum_div_u64_pow10(&q, &n, 5, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "pow10: negative length");
+    ASSERT_TRUE(bignum_mod_u64_small_prime(&n, 5, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "small_prime: negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_div_u64_pow10(&q, &n, 15, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "pow10: length above capacity");
+    ASSERT_TRUE(bignum_mod_u64_small_prime(&n, 5, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "small_prime: length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64 tables ===\n");
+
+    RUN_TEST(test_pow10_matches_div);
+    RUN_TEST(test_pow10_ctx_table);
+    RUN_TEST(test_small_primes_table);
+    RUN_TEST(test_small_prime_mod);
+    RUN_TEST(test_errors);
+    RUN_TEST(test_pow10_with_reciprocal_kernel);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file    test_bignum_div_u64_tree.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief   Тесты для функции bignum_mod_u64_tree.
+ *
+ * @details
+ *   Сверяет остатки с bignum_div_u64_limbs для длин делимого от 0 до 300 и
+ *   4096 слов и числа модулей по обе стороны границ блока, для модулей
+ *   особого вида (2^64 - 1, старший бит, 1) и для входа, на котором
+ *   оценка частного в делении Кнута требует обратного сложения; проверяет
+ *   границу рабочего буфера и коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0xD6E8FEB86659FD93ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+#define MAX_LEN  4096
+#define MAX_K    1000
+
+static uint64_t n_buf[MAX_LEN];
+static uint64_t q_buf[MAX_LEN];
+static uint64_t d_buf[MAX_K];
+static uint64_t rem_buf[MAX_K];
+static uint64_t scratch_buf[BIGNUM_MOD_U64_TREE_SCRATCH(MAX_LEN) + 1];
+
+/** Сверяет bignum_mod_u64_tree с bignum_div_u64_limbs; рабочий буфер — ровно по макросу. */
+static bool matches_limbs(size_t len, size_t k) {
+    size_t words = BIGNUM_MOD_U64_TREE_SCRATCH(len);
+    uint64_t sentinel = 0x5A5A5A5A5A5A5A5Aull;
+    scratch_buf[words] = sentinel;
+    memset(rem_buf, 0xA5, sizeof(rem_buf));
+    if (bignum_mod_u64_tree(n_buf, len, d_buf, k, rem_buf, scratch_buf) != BIGNUM_DIV_U64_OK) return false;
+    if (scratch_buf[words] != sentinel) return false;
+    for (size_t j = 0; j < k; ++j) {
+        uint64_t r = 1;
+        if (bignum_div_u64_limbs(q_buf, n_buf, len, d_buf[j], &r) != BIGNUM_DIV_U64_OK) return false;
+        if (rem_buf[j] != r) return false;
+    }
+    return rem_buf[k] == 0xA5A5A5A5A5A5A5A5ull || k == MAX_K;
+}
+
+static void fill_random(size_t len, size_t k) {
+    for (size_t i = 0; i < len; ++i) n_buf[i] = rng_next();
+    for (size_t j = 0; j < k; ++j) d_buf[j] = (rng_next() >> (rng_next() % 64)) | 1;
+}
+
+// --- Тестовые случаи ---
+
+void test_random_sizes(void) {
+    bool ok = true;
+    for (int round = 0; round < 600 && ok; ++round) {
+        size_t len = rng_next() % 301;
+        size_t k = rng_next() % 300;
+        fill_random(len, k);
+        if (round % 4 == 1 && len > 0) n_buf[len - 1] = 0;  // старший ноль
+        ok = matches_limbs(len, k);
+    }
+    ASSERT_TRUE(ok, "Random len 0..300 and k 0..299 match bignum_div_u64_limbs");
+}
+
+void test_block_boundaries(void) {
+    static const size_t counts[] = {1, 2, 3, BIGNUM_MOD_U64_TREE_BLOCK - 1, BIGNUM_MOD_U64_TREE_BLOCK,
+                                    BIGNUM_MOD_U64_TREE_BLOCK + 1, 2 * BIGNUM_MOD_U64_TREE_BLOCK + 5, MAX_K};
+    bool ok = true;
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]) && ok; ++c) {
+        size_t lens[] = {1, 2, counts[c], 257};
+        for (int l = 0; l < 4 && ok; ++l) {
+            fill_random(lens[l], counts[c]);
+            ok = matches_limbs(lens[l], counts[c]);
+        }
+    }
+    ASSERT_TRUE(ok, "k around block size, short and long n");
+
+    fill_random(MAX_LEN, 300);
+    ASSERT_TRUE(matches_limbs(MAX_LEN, 300), "len = 4096, k = 300");
+}
+
+void test_special_moduli(void) {
+    bool ok = true;
+    for (int round = 0; round < 200 && ok; ++round) {
+        size_t len = rng_next() % 80 + 1;
+        size_t k = rng_next() % 150 + 1;
+        fill_random(len, k);
+        for (size_t j = 0; j < k; ++j) {
+            switch (rng_next() % 4) {
+            case 0: d_buf[j] = ~0ull - (rng_next() % 3); break;
+            case 1: d_buf[j] |= 1ull << 63; break;
+            case 2: d_buf[j] = 1; break;
+            default: break;
+            }
+        }
+        if (round % 2 == 0) {
+            for (size_t i = 0; i < len; ++i) n_buf[i] = (rng_next() & 1) ? ~0ull : 0;
+        }
+        ok = matches_limbs(len, k);
+    }
+    ASSERT_TRUE(ok, "Moduli 2^64 - c, with the top bit set and d = 1; 0/~0 limbs in n");
+
+    // Оценка частного на корне (d0 * d1 * d2) завышена на единицу после уточнения
+    static const uint64_t n_addback[] = {0x7FFFFFFFFFFFFFFFull, 0x8000000000000000ull, 0, 0, 0x7FFFFFFFFFFFFFFFull};
+    memcpy(n_buf, n_addback, sizeof(n_addback));
+    d_buf[0] = ~0ull;
+    d_buf[1] = ~0ull;
+    d_buf[2] = 0xFFFFFFFF00000000ull;
+    ASSERT_TRUE(matches_limbs(5, 3), "Quotient digit corrected by add-back");
+}
+
+void test_empty_inputs(void) {
+    uint64_t rem = 7;
+    d_buf[0] = 12345;
+    ASSERT_TRUE(bignum_mod_u64_tree(NULL, 0, d_buf, 1, &rem, scratch_buf) == BIGNUM_DIV_U64_OK && rem == 0,
+                "len = 0 with NULL n gives zero remainders");
+    rem = 7;
+    ASSERT_TRUE(bignum_mod_u64_tree(n_buf, 4, d_buf, 0, &rem, scratch_buf) == BIGNUM_DIV_U64_OK && rem == 7,
+                "k = 0 writes nothing");
+}
+
+void test_errors(void) {
+    uint64_t rem;
+    uint64_t d_zero[] = {3, 0, 5};
+    fill_random(4, 3);
+    ASSERT_TRUE(bignum_mod_u64_tree(NULL, 4, d_buf, 3, rem_buf, scratch_buf) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_mod_u64_tree(n_buf, 4, NULL, 3, rem_buf, scratch_buf) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL d");
+    ASSERT_TRUE(bignum_mod_u64_tree(n_buf, 4, d_buf, 3, NULL, scratch_buf) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL rem");
+    ASSERT_TRUE(bignum_mod_u64_tree(n_buf, 4, d_buf, 3, rem_buf, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL scratch");
+    rem = 9;
+    ASSERT_TRUE(bignum_mod_u64_tree(n_buf, 4, d_zero, 3, &rem, scratch_buf) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO && rem == 9,
+                "Zero modulus, rem untouched");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_mod_u64_tree ===\n");
+
+    RUN_TEST(test_random_sizes);
+    RUN_TEST(test_block_boundaries);
+    RUN_TEST(test_special_moduli);
+    RUN_TEST(test_empty_inputs);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+/**
+ * @file    test_bignum_div_u64_trial.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief   Тесты для функции bignum_trial_divide.
+ *
+ * @details
+ *   Сверяет битовую карту и первый делитель с bignum_mod_u64 по каждому
+ *   простому для первых 3000 простых и простых около 2^32, на случайных
+ *   числах и на произведениях выбранных простых; проверяет режим без
+ *   карты, делители-непростые, n = 0, count = 0, границы карты и коды
+ *   ошибок.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x94D049BB133111EBull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+/** n *= p; возвращает false при переполнении ёмкости. */
+static bool bignum_mul_u64(bignum_t *n, uint64_t p) {
+    __extension__ typedef unsigned __int128 u128_t;
+    uint64_t carry = 0;
+    for (int i = 0; i < n->len; ++i) {
+        u128_t t = (u128_t)n->words[i] * p + carry;
+        n->words[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
+    if (carry != 0) {
+        if (n->len == BIGNUM_CAPACITY) return false;
+        n->words[n->len++] = carry;
+    }
+    return true;
+}
+
+#define PRIMES_SMALL  3000
+#define PRIMES_TOTAL  (PRIMES_SMALL + 4)
+
+static uint32_t primes[PRIMES_TOTAL];
+
+/** Первые PRIMES_SMALL простых и четыре простых около 2^32. */
+static void fill_primes(void) {
+    int count = 0;
+    for (uint32_t c = 2; count < PRIMES_SMALL; ++c) {
+        bool prime = true;
+        for (int i = 0; i < count && primes[i] * primes[i] <= c; ++i) {
+            if (c % primes[i] == 0) { prime = false; break; }
+        }
+        if (prime) primes[count++] = c;
+    }
+    primes[count++] = 4294967291u;
+    primes[count++] = 4294967279u;
+    primes[count++] = 65537u;
+    primes[count++] = 2147483647u;
+}
+
+#define BITMAP_WORDS(count)  (((count) + 63) / 64)
+
+/** Сверяет bignum_trial_divide с bignum_mod_u64 для list[0..count). */
+static bool matches_mod(const bignum_t *n, const uint32_t *list, size_t count) {
+    uint64_t bitmap[BITMAP_WORDS(PRIMES_TOTAL) + 1];
+    uint64_t sentinel = 0xA5A5A5A5A5A5A5A5ull;
+    memset(bitmap, 0xFF, sizeof(bitmap));
+    bitmap[BITMAP_WORDS(count)] = sentinel;
+    uint32_t divisor = 1, first = 7;
+    if (bignum_trial_divide(n, list, count, &divisor, bitmap) != BIGNUM_DIV_U64_OK) return false;
+    if (bignum_trial_divide(n, list, count, &first, NULL) != BIGNUM_DIV_U64_OK) return false;
+
+    uint32_t expected = 0;
+    for (size_t j = 0; j < count; ++j) {
+        uint64_t r;
+        bignum_mod_u64(n, list[j], &r);
+        bool bit = (bitmap[j / 64] >> (j % 64)) & 1;
+        if (bit != (r == 0)) return false;
+        if (r == 0 && expected == 0) expected = list[j];
+    }
+    for (size_t j = count; j < 64 * BITMAP_WORDS(count); ++j) {
+        if ((bitmap[j / 64] >> (j % 64)) & 1) return false;  // хвост карты
+    }
+    return divisor == expected && first == expected && bitmap[BITMAP_WORDS(count)] == sentinel;
+}
+
+// --- Тестовые случаи ---
+
+void test_random_numbers(void) {
+    bool ok = true;
+    for (int len = 0; len <= BIGNUM_CAPACITY && ok; ++len) {
+        bignum_t n;
+        bignum_random(&n, len);
+        ok = matches_mod(&n, primes, PRIMES_TOTAL);
+    }
+    ASSERT_TRUE(ok, "Random n of every length match bignum_mod_u64 per prime");
+}
+
+void test_products_of_primes(void) {
+    bool ok = true;
+    for (int round = 0; round < 200 && ok; ++round) {
+        bignum_t n;
+        bignum_random(&n, (int)(rng_next() % 8) + 1);
+        n.words[0] |= 1;
+        for (int k = 0; k < 6; ++k) {
+            bignum_mul_u64(&n, primes[rng_next() % PRIMES_TOTAL]);
+        }
+        ok = matches_mod(&n, primes, PRIMES_TOTAL);
+    }
+    ASSERT_TRUE(ok, "n with six chosen prime factors: bitmap and first divisor");
+
+    bignum_t n;
+    bignum_random(&n, 1);
+    n.words[0] = 1;
+    bignum_mul_u64(&n, 4294967291u);
+    bignum_mul_u64(&n, primes[PRIMES_SMALL - 1]);
+    uint32_t divisor = 0;
+    ASSERT_TRUE(bignum_trial_divide(&n, primes, PRIMES_TOTAL, &divisor, NULL) == BIGNUM_DIV_U64_OK &&
+                divisor == primes[PRIMES_SMALL - 1], "First divisor is the earliest in list order");
+}
+
+void test_counts_and_lists(void) {
+    bool ok = true;
+    bignum_t n;
+    bignum_random(&n, BIGNUM_CAPACITY);
+    for (size_t count = 0; count <= 300 && ok; ++count) {
+        ok = matches_mod(&n, primes, count);
+    }
+    ASSERT_TRUE(ok, "Every count from 0 to 300 (partial products and bitmap words)");
+
+    uint32_t list[] = {1, 6, 6, 1000000000u, 4294967295u, 12, 3};
+    bignum_random(&n, 5);
+    ok = matches_mod(&n, list, sizeof(list) / sizeof(list[0]));
+    n.words[0] = 0;
+    n.words[1] = 0;
+    n.words[2] = 0;
+    n.words[3] = 0;
+    n.words[4] = 1;  // 2^256
+    ok = ok && matches_mod(&n, list, sizeof(list) / sizeof(list[0]));
+    ASSERT_TRUE(ok, "Non-prime and repeated divisors");
+
+    bignum_random(&n, 0);
+    uint64_t bitmap[BITMAP_WORDS(PRIMES_TOTAL)];
+    uint32_t divisor = 0;
+    ok = bignum_trial_divide(&n, primes, PRIMES_TOTAL, &divisor, bitmap) == BIGNUM_DIV_U64_OK && divisor == 2;
+    for (size_t j = 0; j < PRIMES_TOTAL; ++j) {
+        if (((bitmap[j / 64] >> (j % 64)) & 1) == 0) ok = false;
+    }
+    ASSERT_TRUE(ok, "n = 0 is divisible by every prime");
+}
+
+void test_errors(void) {
+    bignum_t n;
+    uint64_t bitmap[1];
+    uint32_t divisor = 5;
+    uint32_t list[] = {3, 0, 5};
+    bignum_random(&n, 2);
+    ASSERT_TRUE(bignum_trial_divide(NULL, primes, 3, &divisor, bitmap) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_trial_divide(&n, NULL, 3, &divisor, bitmap) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL primes");
+    ASSERT_TRUE(bignum_trial_divide(&n, primes, 3, NULL, bitmap) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL divisor");
+    bitmap[0] = 0xFF;
+    ASSERT_TRUE(bignum_trial_divide(&n, list, 3, &divisor, bitmap) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO &&
+                divisor == 5 && bitmap[0] == 0xFF, "Zero in primes, outputs untouched");
+    n.len = -1;
+    ASSERT_TRUE(bignum_trial_divide(&n, primes, 3, &divisor, bitmap) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_trial_divide(&n, primes, 3, &divisor, bitmap) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_trial_divide ===\n");
+
+    fill_primes();
+    RUN_TEST(test_random_numbers);
+    RUN_TEST(test_products_of_primes);
+    RUN_TEST(test_counts_and_lists);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,229 @@
+/**
+ * @file    test_bignum_div_u64_u128.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    16.10.2026
+ *
+ * @brief   Тесты для функции bignum_div_u128.
+ *
+ * @details
+ *   Проверяет тождество n = q * d + r и r < d для случайных делимых всех
+ *   длин и делителей от 65 до 128 бит, степеней десяти 10^20..10^38,
+ *   граничных d (2^64, 2^128 - 1, старший бит без сдвига), d > n;
+ *   нормализацию q->len и нулевой хвост, деление на месте, передачу
+ *   d.hi == 0 в bignum_div_u64 и коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (16.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+__extension__ typedef unsigned __int128 u128_t;
+
+static uint64_t rng_state = 0x1B873593CC9E2D51ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+static const size_t COMPARED_BYTES = offsetof(bignum_t, len) + sizeof(int32_t);
+
+/** Проверяет n = q * d + r, r < d, нормализованную длину и нулевой хвост q. */
+static bool identity_holds(const bignum_t *n, const bignum_t *q, bignum_u128_t d, bignum_u128_t r) {
+    if (r.hi > d.hi || (r.hi == d.hi && r.lo >= d.lo)) return false;
+    if (q->len < 0 || q->len > BIGNUM_CAPACITY) return false;
+    if (q->len > 0 && q->words[q->len - 1] == 0) return false;
+    for (int i = q->len; i < BIGNUM_CAPACITY; ++i) {
+        if (q->words[i] != 0) return false;
+    }
+
+    uint64_t acc[BIGNUM_CAPACITY + 3] = {0};
+    acc[0] = r.lo;
+    acc[1] = r.hi;
+    for (int i = 0; i < q->len; ++i) {
+        const uint64_t dw[2] = {d.lo, d.hi};
+        uint64_t carry = 0;
+        for (int j = 0; j < 2; ++j) {
+            u128_t t = (u128_t)q->words[i] * dw[j] + acc[i + j] + carry;
+            acc[i + j] = (uint64_t)t;
+            carry = (uint64_t)(t >> 64);
+        }
+        for (int k = i + 2; carry != 0; ++k) {
+            u128_t t = (u128_t)acc[k] + carry;
+            acc[k] = (uint64_t)t;
+            carry = (uint64_t)(t >> 64);
+        }
+    }
+    for (int i = 0; i < BIGNUM_CAPACITY + 3; ++i) {
+        uint64_t expected = (i < n->len) ? n->words[i] : 0;
+        if (acc[i] != expected) return false;
+    }
+    return true;
+}
+
+/** Делит n на d в отдельный q и на месте; оба результата должны совпасть. */
+static bool divides_correctly(const bignum_t *n, bignum_u128_t d) {
+    bignum_t q, m = *n;
+    bignum_u128_t r = {1, 1}, r_in_place = {2, 2};
+    memset(&q, 0xA5, sizeof(q));
+    if (bignum_div_u128(&q, n, d, &r) != BIGNUM_DIV_U64_OK) return false;
+    if (!identity_holds(n, &q, d, r)) return false;
+    if (bignum_div_u128(&m, &m, d, &r_in_place) != BIGNUM_DIV_U64_OK) return false;
+    return memcmp(&m, &q, COMPARED_BYTES) == 0 && r_in_place.lo == r.lo && r_in_place.hi == r.hi;
+}
+
+static bignum_u128_t u128_make(u128_t x) {
+    bignum_u128_t d = {(uint64_t)x, (uint64_t)(x >> 64)};
+    return d;
+}
+
+// --- Тестовые случаи ---
+
+void test_random_divisors(void) {
+    bool ok = true;
+    for (int len = 0; len <= BIGNUM_CAPACITY && ok; ++len) {
+        for (int round = 0; round < 60 && ok; ++round) {
+            bignum_t n;
+            bignum_random(&n, len);
+            if (round % 6 == 1 && len > 0) n.words[len - 1] = 0;  // старший ноль
+            if (round % 6 == 2) memset(n.words, 0xFF, sizeof(uint64_t) * (size_t)len);
+            bignum_u128_t d = {rng_next(), rng_next() >> (rng_next() % 64)};
+            if (d.hi == 0) d.hi = 1;
+            ok = divides_correctly(&n, d);
+        }
+    }
+    ASSERT_TRUE(ok, "n = q * d + r for random 65..128-bit d at every length, also in place");
+}
+
+void test_powers_of_ten(void) {
+    bool ok = true;
+    u128_t p = 1;
+    for (int k = 1; k <= 38; ++k) {
+        p *= 10;
+        if (k < 20) continue;
+        for (int len = 1; len <= BIGNUM_CAPACITY && ok; len += 3) {
+            bignum_t n;
+            bignum_random(&n, len);
+            ok = divides_correctly(&n, u128_make(p));
+        }
+    }
+    ASSERT_TRUE(ok, "d = 10^20 .. 10^38");
+}
+
+void test_boundary_divisors(void) {
+    static const bignum_u128_t divisors[] = {
+        {0, 1},                                             // 2^64
+        {1, 1},
+        {~0ull, ~0ull},                                     // 2^128 - 1
+        {0, 0x8000000000000000ull},                         // 2^127
+        {~0ull, 0x8000000000000000ull},
+        {0x123456789ABCDEF0ull, 0xFFFFFFFFFFFFFFFEull},
+    };
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(divisors) / sizeof(divisors[0]); ++i) {
+        for (int len = 0; len <= BIGNUM_CAPACITY && ok; ++len) {
+            bignum_t n;
+            bignum_random(&n, len);
+            ok = divides_correctly(&n, divisors[i]);
+            memset(n.words, 0xFF, sizeof(uint64_t) * (size_t)len);
+            ok = ok && divides_correctly(&n, divisors[i]);
+        }
+    }
+    ASSERT_TRUE(ok, "2^64, 2^64 + 1, 2^128 - 1, 2^127 and other edge divisors");
+
+    bignum_t n, q;
+    bignum_u128_t r;
+    bignum_random(&n, 2);
+    n.words[1] = 5;
+    bignum_u128_t d = {0, 6};
+    ASSERT_TRUE(bignum_div_u128(&q, &n, d, &r) == BIGNUM_DIV_U64_OK && q.len == 0 &&
+                r.lo == n.words[0] && r.hi == 5, "d > n gives q = 0, r = n");
+}
+
+void test_narrow_divisor(void) {
+    bool ok = true;
+    for (int len = 0; len <= BIGNUM_CAPACITY && ok; ++len) {
+        bignum_t n, q, q_ref;
+        bignum_random(&n, len);
+        bignum_u128_t d = {rng_next() | 1, 0}, r = {7, 7};
+        uint64_t r_ref = 1;
+        ok = bignum_div_u128(&q, &n, d, &r) == BIGNUM_DIV_U64_OK &&
+             bignum_div_u64(&q_ref, &n, d.lo, &r_ref) == BIGNUM_DIV_U64_OK &&
+             r.lo == r_ref && r.hi == 0 && memcmp(&q, &q_ref, COMPARED_BYTES) == 0;
+    }
+    ASSERT_TRUE(ok, "d.hi == 0 matches bignum_div_u64 and clears rem->hi");
+}
+
+void test_errors(void) {
+    bignum_t n, q;
+    bignum_u128_t r;
+    bignum_u128_t d = {3, 1}, zero = {0, 0};
+    bignum_random(&n, 2);
+    ASSERT_TRUE(bignum_div_u128(NULL, &n, d, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL q");
+    ASSERT_TRUE(bignum_div_u128(&q, NULL, d, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL n");
+    ASSERT_TRUE(bignum_div_u128(&q, &n, d, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "NULL rem");
+    ASSERT_TRUE(bignum_div_u128(&q, &n, zero, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "d = 0");
+    bignum_t pair[2];
+    pair[0] = n;
+    ASSERT_TRUE(bignum_div_u128((bignum_t *)&pair[0].words[1], &pair[0], d, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP,
+                "Partial overlap");
+    n.len = -1;
+    ASSERT_TRUE(bignum_div_u128(&q, &n, d, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Negative length");
+    n.len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_div_u128(&q, &n, d, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Length above capacity");
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u128 ===\n");
+
+    RUN_TEST(test_random_divisors);
+    RUN_TEST(test_powers_of_ten);
+    RUN_TEST(test_boundary_divisors);
+    RUN_TEST(test_narrow_divisor);
+    RUN_TEST(test_errors);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}
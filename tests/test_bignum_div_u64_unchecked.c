@@ -0,0 +1,118 @@
+/**
+ * @file    test_bignum_div_u64_unchecked.c
+ * @author  git@bayborodov.com
+ * @version 1.0.0
+ * @date    15.10.2026
+ *
+ * @brief   Тесты для функции bignum_div_u64_unchecked.
+ *
+ * @details
+ *   На корректных аргументах сверяет результат с bignum_div_u64 на всех
+ *   длинах, в том числе на месте и со старшими нулевыми словами. В
+ *   проверяющей сборке (BIGNUM_DIV_U64_CHECKED) дополнительно проверяет,
+ *   что нарушения контракта возвращают коды ошибок.
+ *
+ * @history
+ *   - rev. 1 (15.10.2026): Создание тестов.
+ */
+
+#include "bignum_div_u64.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+// --- Тестовая обвязка ---
+static int tests_failed = 0;
+#define RUN_TEST(test_func) \
+    do { \
+        printf("--- Running test: %s ---\n", #test_func); \
+        test_func(); \
+    } while (0)
+
+#define ASSERT_TRUE(condition, message) \
+    do { \
+        if (!(condition)) { \
+            printf("    [FAIL] %s\n", message); \
+            tests_failed++; \
+        } else { \
+            printf("    [PASS] %s\n", message); \
+        } \
+    } while (0)
+
+// --- Вспомогательные функции ---
+
+static uint64_t rng_state = 0x9FB21C651E98DF25ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void bignum_random(bignum_t *bn, int len) {
+    memset(bn, 0, sizeof(*bn));
+    bn->len = len;
+    for (int i = 0; i < len; ++i) {
+        bn->words[i] = rng_next();
+    }
+}
+
+// --- Тестовые случаи ---
+
+void test_matches_checked(void) {
+    bool ok = true;
+    for (int round = 0; round < 30; ++round) {
+        uint64_t d = (round == 0) ? 1 : (round == 1) ? 0xFFFFFFFFFFFFFFFFull : rng_next() >> (rng_next() % 64);
+        if (d == 0) d = 13;
+        for (int len = 0; len <= BIGNUM_CAPACITY; ++len) {
+            bignum_t n, q, q_ref;
+            uint64_t r = 1, r_ref = 2;
+            bignum_random(&n, len);
+            if (round % 3 == 2) {
+                for (int i = len / 2; i < len; ++i) n.words[i] = 0;
+            }
+            memset(&q, 0xA5, sizeof(q));
+            if (bignum_div_u64(&q_ref, &n, d, &r_ref) != BIGNUM_DIV_U64_OK) ok = false;
+            if (bignum_div_u64_unchecked(&q, &n, d, &r) != BIGNUM_DIV_U64_OK) ok = false;
+            if (r != r_ref || q.len != q_ref.len || memcmp(q.words, q_ref.words, sizeof(q.words)) != 0) ok = false;
+            if (bignum_div_u64_unchecked(&n, &n, d, &r) != BIGNUM_DIV_U64_OK) ok = false;
+            if (r != r_ref || n.len != q_ref.len || memcmp(n.words, q_ref.words, sizeof(n.words)) != 0) ok = false;
+        }
+    }
+    ASSERT_TRUE(ok, "Matches bignum_div_u64 on valid input (all lengths, in place)");
+}
+
+void test_contract_checks(void) {
+#ifdef BIGNUM_DIV_U64_CHECKED
+    bignum_t pair[2], q;
+    uint64_t r;
+    bignum_random(&pair[0], 3);
+    ASSERT_TRUE(bignum_div_u64_unchecked(NULL, &pair[0], 3, &r) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Checked build: NULL q");
+    ASSERT_TRUE(bignum_div_u64_unchecked(&q, &pair[0], 3, NULL) == BIGNUM_DIV_U64_ERR_NULL_PTR, "Checked build: NULL rem");
+    ASSERT_TRUE(bignum_div_u64_unchecked(&q, &pair[0], 0, &r) == BIGNUM_DIV_U64_ERR_DIVISION_BY_ZERO, "Checked build: d == 0");
+    ASSERT_TRUE(bignum_div_u64_unchecked((bignum_t *)&pair[0].words[1], &pair[0], 3, &r) == BIGNUM_DIV_U64_ERR_BUFFER_OVERLAP,
+                "Checked build: partial overlap");
+    pair[0].len = BIGNUM_CAPACITY + 1;
+    ASSERT_TRUE(bignum_div_u64_unchecked(&q, &pair[0], 3, &r) == BIGNUM_DIV_U64_ERR_BAD_LENGTH, "Checked build: bad length");
+#else
+    printf("    Unchecked build: contract violations are not tested\n");
+#endif
+}
+
+int main() {
+    printf("=== Running Tests for bignum_div_u64_unchecked ===\n");
+
+    RUN_TEST(test_matches_checked);
+    RUN_TEST(test_contract_checks);
+
+    printf("----------------------------------------\n");
+    if (tests_failed == 0) {
+        printf("All tests passed!\n");
+    } else {
+        printf("%d test(s) failed.\n", tests_failed);
+    }
+    printf("========================================\n");
+
+    return (tests_failed == 0) ? 0 : 1;
+}